@@ -21,6 +21,7 @@
 #ifdef IOT_ENABLE_BLYNK
 
 #include "Blynk.h"
+#include "Format.h"
 #include "HeatingController.h"
 #include "Settings.h"
 
@@ -227,9 +228,9 @@ void Blynk::setupHandlers()
     _blynkHandler.setPinReadHandler(
         VirtualPins::BoostRemainingSeconds,
         [this, &buf](const int) {
-            int minutes = m_boostRemainingSecs / 60;
-            int secs = m_boostRemainingSecs - minutes * 60;
-            snprintf(buf, sizeof(buf), "%d:%02d", minutes, secs);
+            const auto minutes = m_boostRemainingSecs / 60;
+            const auto secs = m_boostRemainingSecs - minutes * 60;
+            Format::minutesSeconds(buf, static_cast<uint16_t>(minutes), static_cast<uint8_t>(secs), 1);
             return Variant{ buf };
         }
     );
@@ -416,10 +417,10 @@ void Blynk::updateBoostRemaining(const uint32_t secs)
 
     m_boostRemainingSecs = secs;
 
-    const int m = m_boostRemainingSecs / 60;
-    const int s = m_boostRemainingSecs - m * 60;
-    char buf[10] = { 0 };
-    snprintf(buf, sizeof(buf), "%d:%02d", m, s);
+    const auto m = static_cast<uint16_t>(m_boostRemainingSecs / 60);
+    const auto s = static_cast<uint8_t>(m_boostRemainingSecs % 60);
+    char buf[Format::MinutesSecondsBufferSize] = { 0 };
+    Format::minutesSeconds(buf, m, s, 1);
 
     _blynkHandler.writePin(
         VirtualPins::BoostRemainingSeconds,
@@ -575,8 +576,11 @@ void Blynk::processKeypadButtonPresses()
 template <typename T, int size>
 inline void Blynk::floatToStr(const float f, T(&buf)[size])
 {
-    static_assert(size >= 4, "Output buffer is too small");
-    snprintf(buf, size - 1, "%0.1f", f);
+    static_assert(size >= Format::TenthsBufferSize, "Output buffer is too small");
+
+    // Rounded to tenths, like "%0.1f" without the float printf
+    const auto tenths = static_cast<int16_t>(f * 10 + (f < 0 ? -0.5f : 0.5f));
+    Format::tenths(buf, tenths);
 }
 
 #endif
\ No newline at end of file
@@ -20,14 +20,13 @@
 
 #pragma once
 
-#include "drivers/OneWire.h"
-
-#include <Arduino.h>
+#include "hal/Gpio.h"
+#include "hal/OneWire.h"
 
 namespace Peripherals
 {
     namespace Bus
     {
-        using MainTemperatureOneWire = Drivers::OneWire<D7>;
+        using MainTemperatureOneWire = Hal::OneWire<D7>;
     }
 }
\ No newline at end of file
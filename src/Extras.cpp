@@ -33,4 +33,28 @@ std::string Extras::pgmToStdString(PGM_P str)
     std::string ss(len, 0);
     memcpy_P(&ss[0], str, len);
     return ss;
-}
\ No newline at end of file
+}
+void Extras::base64Encode(const uint8_t* const data, const std::size_t length, std::string& out)
+{
+    static const char Alphabet[] PROGMEM =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    out.reserve(out.size() + (length + 2) / 3 * 4);
+
+    for (std::size_t i = 0; i < length; i += 3) {
+        const auto remaining = length - i;
+
+        uint32_t group = data[i] << 16;
+        if (remaining > 1) {
+            group |= data[i + 1] << 8;
+        }
+        if (remaining > 2) {
+            group |= data[i + 2];
+        }
+
+        out += static_cast<char>(pgm_read_byte(&Alphabet[(group >> 18) & 0x3f]));
+        out += static_cast<char>(pgm_read_byte(&Alphabet[(group >> 12) & 0x3f]));
+        out += remaining > 1 ? static_cast<char>(pgm_read_byte(&Alphabet[(group >> 6) & 0x3f])) : '=';
+        out += remaining > 2 ? static_cast<char>(pgm_read_byte(&Alphabet[group & 0x3f])) : '=';
+    }
+}
@@ -23,7 +23,9 @@
 
 #include <pgmspace.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <string>
 
 // Integer division from Linux kernel
@@ -66,7 +68,19 @@ namespace Extras
         return newValue;
     }
 
+    // The system clock counts from the epoch until it's set by NTP or the RTC,
+    // any earlier time means that it hasn't been synchronized yet
+    constexpr std::time_t SynchronizedTimeMin = 1577836800; // 2020-01-01 00:00:00 UTC
+
+    constexpr bool isTimeSynchronized(const std::time_t utc)
+    {
+        return utc >= SynchronizedTimeMin;
+    }
+
     std::string pgmToStdString(PGM_P str);
+
+    // Appends the standard (RFC 4648) Base64 encoding of the data
+    void base64Encode(const uint8_t* data, std::size_t length, std::string& out);
 }
 
 #endif	/* EXTRAS_H */
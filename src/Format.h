@@ -0,0 +1,129 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Number formatting for the display and the telemetry without printf.
+// The text is written into a caller provided buffer with a terminating zero,
+// the functions return its length. They are constexpr, so constant values
+// can be formatted at compile time too.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Format
+{
+    // Buffer sizes for the longest texts, including the terminating zero
+    constexpr std::size_t IntegerBufferSize = 12;        // "-2147483648"
+    constexpr std::size_t TenthsBufferSize = 8;          // "-3276.8"
+    constexpr std::size_t HoursMinutesBufferSize = 6;    // "23:59"
+    constexpr std::size_t MinutesSecondsBufferSize = 10; // "65535:59"
+
+    constexpr uint8_t digitCount(uint32_t value)
+    {
+        uint8_t count = 1;
+        while (value >= 10) {
+            value /= 10;
+            ++count;
+        }
+
+        return count;
+    }
+
+    // Pads with the fill character on the left to the given width
+    constexpr std::size_t unsignedInteger(char* buf, uint32_t value, const uint8_t width = 0, const char fill = ' ')
+    {
+        const auto digits = digitCount(value);
+
+        std::size_t length = 0;
+        while (length + digits < width) {
+            buf[length++] = fill;
+        }
+
+        length += digits;
+        buf[length] = 0;
+
+        auto* p = buf + length;
+        do {
+            *--p = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+
+        return length;
+    }
+
+    // Like "%*d", the sign is written after the padding
+    constexpr std::size_t integer(char* buf, const int32_t value, const uint8_t width = 0)
+    {
+        const auto magnitude = value < 0 ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+        const uint8_t sign = value < 0 ? 1 : 0;
+
+        std::size_t length = 0;
+        while (length + sign + digitCount(magnitude) < width) {
+            buf[length++] = ' ';
+        }
+
+        if (sign) {
+            buf[length++] = '-';
+        }
+
+        return length + unsignedInteger(buf + length, magnitude);
+    }
+
+    // Tenths of a unit with one decimal, e.g. -15 as "-1.5"
+    constexpr std::size_t tenths(char* buf, const int16_t value, const uint8_t width = 0)
+    {
+        const auto magnitude = static_cast<uint16_t>(value < 0 ? -value : value);
+        const uint8_t sign = value < 0 ? 1 : 0;
+
+        std::size_t length = 0;
+        while (length + sign + digitCount(magnitude / 10) + 2 < width) {
+            buf[length++] = ' ';
+        }
+
+        if (sign) {
+            buf[length++] = '-';
+        }
+
+        length += unsignedInteger(buf + length, magnitude / 10);
+        buf[length++] = '.';
+        buf[length++] = static_cast<char>('0' + magnitude % 10);
+        buf[length] = 0;
+
+        return length;
+    }
+
+    // "HH:MM", both zero padded
+    constexpr std::size_t hoursMinutes(char* buf, const uint8_t hours, const uint8_t minutes, const char separator = ':')
+    {
+        auto length = unsignedInteger(buf, hours, 2, '0');
+        buf[length++] = separator;
+        return length + unsignedInteger(buf + length, minutes, 2, '0');
+    }
+
+    // "MMM:SS", the minutes padded with spaces to the given width
+    constexpr std::size_t minutesSeconds(char* buf, const uint16_t minutes, const uint8_t seconds, const uint8_t minutesWidth = 3)
+    {
+        auto length = unsignedInteger(buf, minutes, minutesWidth);
+        buf[length++] = ':';
+        return length + unsignedInteger(buf + length, seconds, 2, '0');
+    }
+}
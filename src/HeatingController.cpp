@@ -23,8 +23,9 @@
 #include "TemperatureSensor.h"
 #include "Config.h"
 #include "Extras.h"
+#include "TraceRecorder.h"
 
-#include <Arduino.h>
+#include "hal/Gpio.h"
 
 #define TEMPERATURE_STEP	5
 
@@ -40,8 +41,8 @@ HeatingController::HeatingController(
     _log.info_P(PSTR("initializing"));
 
     // Setup relay control pin
-    digitalWrite(D8, LOW);
-    pinMode(D8, OUTPUT);
+    Hal::Gpio::write(D8, false);
+    Hal::Gpio::setMode(D8, Hal::Gpio::Mode::Output);
 
     loadStoredTargetTemp();
 }
@@ -299,10 +300,9 @@ void HeatingController::setDaytimeTemp(TenthsOfDegrees temp)
 {
     _log.info_P(PSTR("setting daytime temp: %d"), temp);
 
-    _settings.data.HeatingController.DaytimeTemp = Extras::clampValue(
-        temp,
-        Limits::HeatingController::DaytimeTempMin,
-        Limits::HeatingController::DaytimeTempMax
+    _settings.data.HeatingController.DaytimeTemp = Settings::clampFieldValue(
+        Settings::Field::DaytimeTemp,
+        temp
     );
 }
 
@@ -315,10 +315,9 @@ void HeatingController::setNightTimeTemp(TenthsOfDegrees temp)
 {
     _log.info_P(PSTR("setting night time temp: %d"), temp);
 
-    _settings.data.HeatingController.NightTimeTemp = Extras::clampValue(
-        temp,
-        Limits::HeatingController::NightTimeTempMin,
-        Limits::HeatingController::NightTimeTempMax
+    _settings.data.HeatingController.NightTimeTemp = Settings::clampFieldValue(
+        Settings::Field::NightTimeTemp,
+        temp
     );
 }
 
@@ -395,19 +394,12 @@ void HeatingController::markCustomTempSet()
 
 void HeatingController::clampTargetTemp()
 {
-    if (_usingDaytimeSchedule) {
-        _targetTemp = Extras::clampValue(
-            _targetTemp,
-            Limits::HeatingController::DaytimeTempMin,
-            Limits::HeatingController::DaytimeTempMax
-        );
-    } else {
-        _targetTemp = Extras::clampValue(
-            _targetTemp,
-            Limits::HeatingController::NightTimeTempMin,
-            Limits::HeatingController::NightTimeTempMax
-        );
-    }
+    _targetTemp = Settings::clampFieldValue(
+        _usingDaytimeSchedule
+            ? Settings::Field::DaytimeTemp
+            : Settings::Field::NightTimeTemp,
+        _targetTemp
+    );
 }
 
 void HeatingController::startHeating()
@@ -415,7 +407,9 @@ void HeatingController::startHeating()
     _log.info_P(PSTR("activating relay"));
 
     _heatingActive = true;
-    digitalWrite(D8, HIGH);
+    Hal::Gpio::write(D8, true);
+
+    TraceRecorder::recordRelay(true);
 }
 
 void HeatingController::stopHeating()
@@ -423,7 +417,9 @@ void HeatingController::stopHeating()
     _log.info_P(PSTR("deactivating relay"));
 
     _heatingActive = false;
-    digitalWrite(D8, LOW);
+    Hal::Gpio::write(D8, false);
+
+    TraceRecorder::recordRelay(false);
 }
 
 bool HeatingController::isCustomTempResetNeeded() const
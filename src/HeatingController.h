@@ -48,6 +48,11 @@ public:
         _Last = Off
     };
 
+    static_assert(Limits::HeatingController::ModeMin == static_cast<int>(Mode::_First), "Mode limits don't match the modes");
+    static_assert(Limits::HeatingController::ModeMax == static_cast<int>(Mode::_Last), "Mode limits don't match the modes");
+    static_assert(DefaultSettings::HeatingController::Mode == static_cast<int>(Mode::Normal), "Default mode must be Normal");
+    static_assert(DefaultSettings::HeatingController::FallbackMode == static_cast<int>(Mode::Off), "Fallback mode must be Off");
+
     enum class State
     {
         Off,
@@ -19,163 +19,223 @@
 */
 
 #include "Keypad.h"
+#include "SpscQueue.h"
 
-#include <Arduino.h>
-#include <string.h>
+#include "hal/Gpio.h"
+#include "hal/Interrupts.h"
+#include "hal/Time.h"
 
-namespace Params
+namespace
 {
-    static constexpr auto ScanSampleCount = 10;
-    static constexpr auto ScanReadDelay = 4;
-    static constexpr auto ScanDriveDelay = 7;
+    // Rows: D5 (GPIO14), D6 (GPIO12)
+    // Columns: D0 (GPIO16), D3 (GPIO0), D4 (GPIO2)
+    // The GPIO mask functions are used, since pinMode() and digitalRead()
+    // are not safe to call from interrupt handlers.
+    constexpr uint32_t Row1Mask = 1 << 14;
+    constexpr uint32_t Row2Mask = 1 << 12;
+    constexpr uint32_t RowsMask = Row1Mask | Row2Mask;
+    constexpr uint32_t Col2Mask = 1 << 0;
+    constexpr uint32_t Col3Mask = 1 << 2;
+
+    constexpr auto KeyCount = 6;
+    constexpr uint32_t SettleMicros = 4;
+
+    volatile bool Parked = false;
+    uint32_t SamplePeriodCycles = 0;
+    uint32_t SettleCycles = 0;
+
+    uint8_t Integrators[KeyCount] = {};
+    uint32_t NextRepeat[KeyCount] = {};
+    volatile uint8_t PressedKeys = 0;
+    uint8_t LongPressedKeys = 0;
+    uint8_t IdleSamples = 0;
+    volatile uint16_t DroppedEvents = 0;
+
+    SpscQueue<Keypad::KeyEvent, Keypad::EventQueueSize> Events;
+
+    inline __attribute__((always_inline)) void settle()
+    {
+        Hal::Time::delayCycles(SettleCycles);
+    }
 
-    static constexpr auto PressDurationToRepeat = 15;
-    static constexpr auto ResetDelayAfterKeysChanged = 3;
-    static constexpr auto RepeatInterval = 3;
+    inline __attribute__((always_inline)) uint8_t readColumns()
+    {
+        uint8_t columns = 0;
+        const auto inputs = Hal::Gpio::readInputs();
 
-    static constexpr auto DriveDelay = 7;
-}
+        if (!Hal::Gpio::readGpio16()) {
+            columns |= 1 << 0;
+        }
+        if ((inputs & Col2Mask) == 0) {
+            columns |= 1 << 1;
+        }
+        if ((inputs & Col3Mask) == 0) {
+            columns |= 1 << 2;
+        }
 
-Keypad::Keypad()
-{
-    // TODO move pin numbers to a common config file
-    pinMode(D0, INPUT_PULLUP);
-    pinMode(D3, INPUT_PULLUP);
-    pinMode(D4, INPUT_PULLUP);
-    pinMode(D5, INPUT_PULLUP);
-    pinMode(D6, INPUT_PULLUP);
-}
+        return columns;
+    }
 
-Keypad::Keys Keypad::scan()
-{
-    if (millis() > _lastScanTimestamp + 15) {
-        tick();
-        _lastScanTimestamp = millis();
+    uint8_t IRAM_ATTR sampleMatrix()
+    {
+        // Release both rows, they are driven low while parked
+        Hal::Gpio::disableOutputs(RowsMask);
+
+        // Row 1
+        Hal::Gpio::clearOutputs(Row1Mask);
+        Hal::Gpio::enableOutputs(Row1Mask);
+        settle();
+        uint8_t keys = readColumns();
+        Hal::Gpio::disableOutputs(Row1Mask);
+
+        settle();
+
+        // Row 2
+        Hal::Gpio::clearOutputs(Row2Mask);
+        Hal::Gpio::enableOutputs(Row2Mask);
+        settle();
+        keys |= readColumns() << 3;
+        Hal::Gpio::disableOutputs(Row2Mask);
+
+        return keys;
     }
 
-    if (_delay > 0)
-        return Keys::None;
+    void IRAM_ATTR pushEvent(const uint8_t key, const Keypad::KeyEvent::Type type, const uint32_t timestamp)
+    {
+        Keypad::KeyEvent event;
+        event.key = static_cast<Keypad::Keys>(1 << key);
+        event.type = type;
+        event.timestamp = timestamp;
 
-    const auto readKeys = readInputs();
+        if (!Events.push(event)) {
+            DroppedEvents = DroppedEvents + 1;
+        }
+    }
 
-    switch (_state)
+    void IRAM_ATTR park()
     {
-        case State::Idle:
-            // If there is a pressed key, start measuring the
-            // duration until we activate long press mode
-            if (readKeys != Keys::None) {
-                _state = State::Pressed;
-                _pressDuration = 0;
-                _pressedKeys = readKeys;
-                return _pressedKeys;
-            }
-            break;
-
-        case State::Pressed:
-            // If there was a change, reset the state machine
-            // and wait a little bit
-            if (_pressedKeys != readKeys) {
-                _state = State::Idle;
-                _delay = Params::ResetDelayAfterKeysChanged;
-            } else {
-                // The keys are pressed long enough to start repeating
-                if (_pressDuration > Params::PressDurationToRepeat) {
-                    _state = State::Repeating;
-                    _delay = Params::RepeatInterval;
-                    return _pressedKeys | Keys::LongPress;
-                }
-            }
-            break;
-
-        case State::Repeating:
-            // If there was a change, reset the state machine
-            // and wait a little bit
-            if (_pressedKeys != readKeys) {
-                _state = State::Idle;
-                _delay = Params::ResetDelayAfterKeysChanged;
-            } else {
-                // Keep on repeating and resetting the delay counter
-                _delay = Params::RepeatInterval;
-                return _pressedKeys | Keys::LongPress;
-            }
-            break;
+        // Drive both rows low, so any key press pulls its column low
+        Hal::Gpio::clearOutputs(RowsMask);
+        Hal::Gpio::enableOutputs(RowsMask);
+
+        Parked = true;
     }
 
-    return Keys::None;
-}
+    void IRAM_ATTR wake()
+    {
+        if (!Parked) {
+            return;
+        }
 
-/**
- * Reads the keypad with software de-bouncing
- */
-Keypad::Keys Keypad::readInputs() const
-{
-    Keys pressed = Keys::None;
+        Parked = false;
+        IdleSamples = 0;
 
-    for (uint8_t samples = 0; samples < Params::ScanSampleCount; ++samples) {
-        Keys readKeys = Keys::None;
+        Hal::CycleTimer::armAt(Hal::Time::cycleCount() + SamplePeriodCycles);
+    }
 
-        // Row 1
-        digitalWrite(D5, LOW);
-        pinMode(D5, OUTPUT);
+    void IRAM_ATTR onSampleTimer()
+    {
+        const auto now = Hal::Time::millis();
+        const auto keys = sampleMatrix();
+
+        for (uint8_t i = 0; i < KeyCount; ++i) {
+            const uint8_t mask = 1 << i;
+
+            // Integrate the samples, the state changes at the limits only
+            if (keys & mask) {
+                if (Integrators[i] < Keypad::DebounceSamples) {
+                    ++Integrators[i];
+                }
+            } else if (Integrators[i] > 0) {
+                --Integrators[i];
+            }
 
-        // Col 1
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D0) == 0) {
-            readKeys |= Keys::Row1Col1;
+            if (!(PressedKeys & mask)) {
+                if (Integrators[i] == Keypad::DebounceSamples) {
+                    PressedKeys = PressedKeys | mask;
+                    NextRepeat[i] = now + Keypad::LongPressMs;
+                    pushEvent(i, Keypad::KeyEvent::Type::Press, now);
+                }
+            } else {
+                if (Integrators[i] == 0) {
+                    PressedKeys = PressedKeys & ~mask;
+                    LongPressedKeys &= ~mask;
+                    pushEvent(i, Keypad::KeyEvent::Type::Release, now);
+                } else if (static_cast<int32_t>(now - NextRepeat[i]) >= 0) {
+                    const auto type = (LongPressedKeys & mask)
+                        ? Keypad::KeyEvent::Type::Repeat
+                        : Keypad::KeyEvent::Type::LongPress;
+
+                    LongPressedKeys |= mask;
+                    NextRepeat[i] = now + Keypad::RepeatIntervalMs;
+                    pushEvent(i, type, now);
+                }
+            }
         }
 
-        // Col 2
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D3) == 0) {
-            readKeys |= Keys::Row1Col2;
+        bool active = keys != 0 || PressedKeys != 0;
+        for (uint8_t i = 0; i < KeyCount && !active; ++i) {
+            active = Integrators[i] > 0;
         }
 
-        // Col 3
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D4) == 0) {
-            readKeys |= Keys::Row1Col3;
+        if (active) {
+            IdleSamples = 0;
+        } else if (++IdleSamples >= Keypad::IdleSamplesToPark) {
+            park();
+            return;
         }
 
-        pinMode(D5, INPUT_PULLUP);
-        delayMicroseconds(Params::ScanReadDelay);
-        delayMicroseconds(Params::ScanDriveDelay);
+        Hal::CycleTimer::armAt(Hal::Time::cycleCount() + SamplePeriodCycles);
+    }
 
-        // Row 2
-        digitalWrite(D6, LOW);
-        pinMode(D6, OUTPUT);
+    void IRAM_ATTR onColumnEdge()
+    {
+        wake();
+    }
+}
 
-        // Col 1
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D0) == 0) {
-            readKeys |= Keys::Row2Col1;
-        }
+Keypad::Keypad()
+{
+    // TODO move pin numbers to a common config file
+    Hal::Gpio::setMode(D0, Hal::Gpio::Mode::InputPullup);
+    Hal::Gpio::setMode(D3, Hal::Gpio::Mode::InputPullup);
+    Hal::Gpio::setMode(D4, Hal::Gpio::Mode::InputPullup);
+    Hal::Gpio::setMode(D5, Hal::Gpio::Mode::InputPullup);
+    Hal::Gpio::setMode(D6, Hal::Gpio::Mode::InputPullup);
 
-        // Col 2
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D3) == 0) {
-            readKeys |= Keys::Row2Col2;
-        }
+    SamplePeriodCycles = Hal::Time::cpuFreqMHz() * 1000 * SampleIntervalMs;
+    SettleCycles = Hal::Time::cpuFreqMHz() * SettleMicros;
 
-        // Col 3
-        delayMicroseconds(Params::ScanReadDelay);
-        if (digitalRead(D4) == 0) {
-            readKeys |= Keys::Row2Col3;
-        }
+    Hal::CycleTimer::attach(onSampleTimer);
+
+    park();
 
-        pinMode(D6, INPUT_PULLUP);
-        delayMicroseconds(Params::ScanReadDelay);
+    // The edges are ignored while sampling
+    Hal::Gpio::attachFallingInterrupt(D3, onColumnEdge);
+    Hal::Gpio::attachFallingInterrupt(D4, onColumnEdge);
+}
 
-        pressed |= readKeys;
+void Keypad::scan()
+{
+    if (!Parked || Hal::Gpio::readGpio16()) {
+        return;
     }
 
-    return pressed;
+    Hal::Interrupts::Lock lock;
+    wake();
+}
+
+bool Keypad::takeEvent(KeyEvent& event)
+{
+    return Events.pop(event);
 }
 
-void Keypad::tick()
+Keypad::Keys Keypad::pressedKeys() const
 {
-    if (_pressDuration < 255)
-        ++_pressDuration;
+    return static_cast<Keys>(PressedKeys);
+}
 
-    if (_delay > 0)
-        --_delay;
-}
\ No newline at end of file
+uint16_t Keypad::droppedEventCount() const
+{
+    return DroppedEvents;
+}
@@ -49,26 +49,51 @@ public:
         Left            = Row2Col3
     };
 
+    struct KeyEvent
+    {
+        enum class Type : uint8_t
+        {
+            Press,
+            Release,
+            LongPress,
+            Repeat
+        };
+
+        Keys key = Keys::None;
+        Type type = Type::Press;
+        uint32_t timestamp = 0;
+    };
+
+    // Keys are sampled and debounced from a timer interrupt. While no keys
+    // are pressed, the sampling stops and the rows are parked low, so a key
+    // press wakes the sampler through the column interrupts.
+    static constexpr auto SampleIntervalMs = 5;
+
+    // A key changes state after this many consecutive identical samples
+    static constexpr auto DebounceSamples = 4;
+
+    static constexpr auto LongPressMs = 240;
+    static constexpr auto RepeatIntervalMs = 48;
+
+    // Samples without any key activity before parking
+    static constexpr auto IdleSamplesToPark = 20;
+
+    // Column 1 can't generate interrupts (GPIO16), it has to be polled
+    // with this interval by calling scan() while the keypad is parked
+    static constexpr auto ScanIntervalMs = 15;
+
+    static constexpr auto EventQueueSize = 16;
+
     Keypad();
 
-    Keys scan();
+    void scan();
 
-private:
-    enum class State
-    {
-        Idle,
-        Pressed,
-        Repeating
-    };
+    bool takeEvent(KeyEvent& event);
 
-    State _state = State::Idle;
-    Keys _pressedKeys = Keys::None;
-    uint8_t _pressDuration = 0;
-    uint8_t _delay = 0;
-    uint32_t _lastScanTimestamp = 0;
+    // Debounced state of the keys, for detecting chords
+    Keys pressedKeys() const;
 
-    Keys readInputs() const;
-    void tick();
+    uint16_t droppedEventCount() const;
 };
 
 inline Keypad::Keys operator |(const Keypad::Keys k1, const Keypad::Keys k2)
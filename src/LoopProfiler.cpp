@@ -0,0 +1,147 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#ifdef THERMOSTAT_ENABLE_PROFILER
+
+#include "LoopProfiler.h"
+
+#include <Logger.h>
+#include <pgmspace.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    LoopProfiler::Statistics StageStatistics[LoopProfiler::StageCount];
+
+    // Stage name copied into RAM
+    struct StageName
+    {
+        explicit StageName(const std::size_t index)
+        {
+            strncpy_P(text, loopStageName(static_cast<LoopStage>(index)), sizeof(text) - 1);
+        }
+
+        char text[20] = { 0 };
+    };
+
+    uint32_t cyclesToMicros(const uint32_t cycles)
+    {
+        return cycles / Hal::Time::cpuFreqMHz();
+    }
+
+    std::size_t bucketIndex(const uint32_t micros)
+    {
+        if (micros == 0) {
+            return 0;
+        }
+
+        const std::size_t log2 = 32 - __builtin_clz(micros);
+
+        return std::min<std::size_t>(log2, LoopProfiler::BucketCount - 1);
+    }
+}
+
+void LoopProfiler::record(const Stage stage, const uint32_t cycles)
+{
+    auto& s = StageStatistics[static_cast<std::size_t>(stage)];
+
+    ++s.count;
+    s.maxCycles = std::max(s.maxCycles, cycles);
+
+    auto& bucket = s.buckets[bucketIndex(cyclesToMicros(cycles))];
+    if (bucket < UINT16_MAX) {
+        ++bucket;
+    }
+}
+
+void LoopProfiler::reset()
+{
+    memset(StageStatistics, 0, sizeof(StageStatistics));
+}
+
+const LoopProfiler::Statistics& LoopProfiler::statistics(const Stage stage)
+{
+    return StageStatistics[static_cast<std::size_t>(stage)];
+}
+
+void LoopProfiler::dump(const Logger& log)
+{
+    for (std::size_t i = 0; i < StageCount; ++i) {
+        const auto& s = StageStatistics[i];
+
+        char buckets[BucketCount * 6 + 1] = { 0 };
+        std::size_t length = 0;
+
+        for (std::size_t j = 0; j < BucketCount; ++j) {
+            length += snprintf_P(buckets + length, sizeof(buckets) - length, PSTR("%s%u"), j > 0 ? "," : "", s.buckets[j]);
+        }
+
+        log.info_P(PSTR("%s: count=%u, max=%uus, log2(us) histogram=%s"),
+            StageName(i).text,
+            s.count,
+            cyclesToMicros(s.maxCycles),
+            buckets
+        );
+    }
+}
+
+std::size_t LoopProfiler::toJson(char* const buffer, const std::size_t size)
+{
+    if (size == 0) {
+        return 0;
+    }
+
+    std::size_t length = 0;
+
+    const auto append = [&](const int written) {
+        if (written > 0) {
+            length = std::min(length + written, size - 1);
+        }
+    };
+
+    append(snprintf_P(buffer, size, PSTR("{")));
+
+    for (std::size_t i = 0; i < StageCount; ++i) {
+        const auto& s = StageStatistics[i];
+
+        append(snprintf_P(buffer + length, size - length, PSTR(R"(%s"%s":{"count":%u,"maxUs":%u,"hist":[)"),
+            i > 0 ? "," : "",
+            StageName(i).text,
+            s.count,
+            cyclesToMicros(s.maxCycles)
+        ));
+
+        for (std::size_t j = 0; j < BucketCount; ++j) {
+            append(snprintf_P(buffer + length, size - length, PSTR("%s%u"), j > 0 ? "," : "", s.buckets[j]));
+        }
+
+        append(snprintf_P(buffer + length, size - length, PSTR("]}")));
+    }
+
+    append(snprintf_P(buffer + length, size - length, PSTR("}")));
+
+    return length;
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Cycle counter based latency profiler for the main loop stages.
+// Compiled out unless THERMOSTAT_ENABLE_PROFILER is defined.
+//
+// Stages are marked with LOOP_STAGE() from LoopStage.h.
+
+#include "LoopStage.h"
+
+#ifdef THERMOSTAT_ENABLE_PROFILER
+
+#include "hal/Time.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class Logger;
+
+class LoopProfiler
+{
+public:
+    using Stage = LoopStage;
+
+    static constexpr auto StageCount = LoopStageCount;
+
+    // Bucket 0: < 1 us, bucket N: [2^(N-1), 2^N) us, the last one is open-ended
+    static constexpr auto BucketCount = 16;
+
+    struct Statistics
+    {
+        uint32_t count;
+        uint32_t maxCycles;
+        uint16_t buckets[BucketCount];
+    };
+
+    class Scope
+    {
+    public:
+        explicit Scope(const Stage stage)
+            : _stage(stage)
+            , _startCycles(Hal::Time::cycleCount())
+        {}
+
+        ~Scope()
+        {
+            record(_stage, Hal::Time::cycleCount() - _startCycles);
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const Stage _stage;
+        const uint32_t _startCycles;
+    };
+
+    static void record(Stage stage, uint32_t cycles);
+    static void reset();
+
+    static const Statistics& statistics(Stage stage);
+
+    // Writes a line per stage into the log
+    static void dump(const Logger& log);
+
+    // Serializes the statistics as JSON, returns the length
+    static std::size_t toJson(char* buffer, std::size_t size);
+};
+
+#define PROFILE_CONCAT_IMPL(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_IMPL(A, B)
+#define PROFILE_STAGE(STAGE) \
+    const LoopProfiler::Scope PROFILE_CONCAT(_profilerScope, __LINE__){ LoopStage::STAGE }
+
+#else
+
+#define PROFILE_STAGE(STAGE)
+
+#endif
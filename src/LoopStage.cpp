@@ -0,0 +1,57 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "LoopStage.h"
+
+namespace
+{
+    const char StageName0[] PROGMEM = "CoreApplication";
+    const char StageName1[] PROGMEM = "UiTask";
+    const char StageName2[] PROGMEM = "TemperatureSensor";
+    const char StageName3[] PROGMEM = "HeatingController";
+    const char StageName4[] PROGMEM = "UiUpdate";
+    const char StageName5[] PROGMEM = "SettingsSave";
+    const char StageName6[] PROGMEM = "MqttPublish";
+    const char NoStageName[] PROGMEM = "None";
+
+    PGM_P const StageNames[] PROGMEM = {
+        StageName0,
+        StageName1,
+        StageName2,
+        StageName3,
+        StageName4,
+        StageName5,
+        StageName6
+    };
+
+    static_assert(sizeof(StageNames) / sizeof(StageNames[0]) == LoopStageCount, "Stage name missing");
+}
+
+PGM_P loopStageName(const LoopStage stage)
+{
+    const auto index = static_cast<std::size_t>(stage);
+
+    if (index >= LoopStageCount) {
+        return NoStageName;
+    }
+
+    return reinterpret_cast<PGM_P>(pgm_read_ptr(&StageNames[index]));
+}
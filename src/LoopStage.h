@@ -0,0 +1,53 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <pgmspace.h>
+
+// Instrumented stages of the main loop
+enum class LoopStage : uint8_t
+{
+    CoreApplication,
+    UiTask,
+    TemperatureSensor,
+    HeatingController,
+    UiUpdate,
+    SettingsSave,
+    MqttPublish,
+
+    _Count
+};
+
+constexpr auto LoopStageCount = static_cast<std::size_t>(LoopStage::_Count);
+
+PGM_P loopStageName(LoopStage stage);
+
+#include "LoopProfiler.h"
+#include "LoopWatchdog.h"
+
+// Marks the enclosing scope as a main loop stage for the profiler and the watchdog
+#define LOOP_STAGE(STAGE) \
+    PROFILE_STAGE(STAGE); \
+    WATCHDOG_STAGE(STAGE)
@@ -0,0 +1,163 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+
+#include "LoopWatchdog.h"
+
+#include <Arduino.h>
+
+#include <cstring>
+
+namespace
+{
+    constexpr uint32_t RecordMagic = 0x57444f47;
+    constexpr uint32_t RtcUserMemoryAddress = 0x60001200;
+    constexpr auto RecordWords = sizeof(LoopWatchdog::Record) / sizeof(uint32_t);
+
+    static_assert(sizeof(LoopWatchdog::Record) % sizeof(uint32_t) == 0, "Record must consist of whole words");
+
+    // timer1 runs from the 80 MHz APB clock
+    constexpr uint32_t TimerTicks = 80000000 / 256 / 1000 * LoopWatchdog::CheckIntervalMs;
+
+    volatile uint32_t LoopStartMs = 0;
+    volatile uint32_t StageStartMs = 0;
+    volatile uint8_t Stage = LoopWatchdog::NoStage;
+    volatile uint8_t OuterStage = LoopWatchdog::NoStage;
+    volatile bool StallRecorded = false;
+    volatile bool Running = false;
+
+    uint32_t IRAM_ATTR checksum(const uint32_t* const words, const std::size_t count)
+    {
+        uint32_t sum = 0x12345678;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            sum = (sum << 5 | sum >> 27) ^ words[i];
+        }
+
+        return sum;
+    }
+
+    void IRAM_ATTR onTimer()
+    {
+        if (!Running || StallRecorded) {
+            return;
+        }
+
+        const auto now = millis();
+
+        if (now - LoopStartMs < LoopWatchdog::BudgetMs) {
+            return;
+        }
+
+        StallRecorded = true;
+
+        // ESP.rtcUserMemory*() is not IRAM-safe, access the memory directly
+        auto* const rtc = reinterpret_cast<volatile uint32_t*>(
+            RtcUserMemoryAddress + LoopWatchdog::RtcMemoryOffset * sizeof(uint32_t)
+        );
+
+        LoopWatchdog::Record record;
+        auto* const words = reinterpret_cast<uint32_t*>(&record);
+
+        for (std::size_t i = 0; i < RecordWords; ++i) {
+            words[i] = rtc[i];
+        }
+
+        const auto valid = record.magic == RecordMagic
+            && record.checksum == checksum(words, RecordWords - 1);
+
+        record.magic = RecordMagic;
+        record.stage = Stage;
+        record.outerStage = OuterStage;
+        record.stallCount = valid && record.stallCount < UINT16_MAX ? record.stallCount + 1 : 1;
+        record.stageElapsedMs = now - StageStartMs;
+        record.loopElapsedMs = now - LoopStartMs;
+        record.uptimeMs = now;
+        record.checksum = checksum(words, RecordWords - 1);
+
+        for (std::size_t i = 0; i < RecordWords; ++i) {
+            rtc[i] = words[i];
+        }
+    }
+}
+
+LoopWatchdog::Scope::Scope(const LoopStage stage)
+    : _outerStage(Stage)
+    , _outerOuterStage(OuterStage)
+    , _outerStageStartMs(StageStartMs)
+{
+    OuterStage = _outerStage;
+    StageStartMs = millis();
+    Stage = static_cast<uint8_t>(stage);
+}
+
+LoopWatchdog::Scope::~Scope()
+{
+    Stage = _outerStage;
+    StageStartMs = _outerStageStartMs;
+    OuterStage = _outerOuterStage;
+}
+
+void LoopWatchdog::start()
+{
+    LoopStartMs = millis();
+
+    timer1_isr_init();
+    timer1_attachInterrupt(onTimer);
+    timer1_enable(TIM_DIV256, TIM_EDGE, TIM_LOOP);
+    timer1_write(TimerTicks);
+
+    Running = true;
+}
+
+bool LoopWatchdog::feed()
+{
+    LoopStartMs = millis();
+
+    if (!StallRecorded) {
+        return false;
+    }
+
+    StallRecorded = false;
+
+    return true;
+}
+
+bool LoopWatchdog::readRecord(Record& record)
+{
+    if (!ESP.rtcUserMemoryRead(RtcMemoryOffset, reinterpret_cast<uint32_t*>(&record), sizeof(Record))) {
+        return false;
+    }
+
+    return record.magic == RecordMagic
+        && record.checksum == checksum(reinterpret_cast<const uint32_t*>(&record), RecordWords - 1);
+}
+
+void LoopWatchdog::clearRecord()
+{
+    Record record;
+    memset(&record, 0, sizeof(record));
+
+    ESP.rtcUserMemoryWrite(RtcMemoryOffset, reinterpret_cast<uint32_t*>(&record), sizeof(Record));
+}
+
+#endif
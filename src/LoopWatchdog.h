@@ -0,0 +1,101 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Software watchdog for the main loop. A timer1 interrupt checks the duration
+// of the current loop iteration and when it exceeds the budget, it stores
+// the stage (see LOOP_STAGE()) which was running into the RTC user memory.
+// The record survives a watchdog or exception reset and can be reported
+// after the next boot.
+// Compiled out unless THERMOSTAT_ENABLE_LOOP_WATCHDOG is defined.
+
+#include "LoopStage.h"
+
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+
+#include <cstdint>
+
+#ifndef THERMOSTAT_LOOP_WATCHDOG_BUDGET_MS
+// Must be shorter than the SDK's software watchdog timeout (~3 s)
+#define THERMOSTAT_LOOP_WATCHDOG_BUDGET_MS 2000
+#endif
+
+class LoopWatchdog
+{
+public:
+    static constexpr uint32_t BudgetMs = THERMOSTAT_LOOP_WATCHDOG_BUDGET_MS;
+    static constexpr uint32_t CheckIntervalMs = 100;
+
+    // RTC user memory offset in 4-byte blocks,
+    // the first 128 bytes are used by eboot for OTA updates
+    static constexpr uint32_t RtcMemoryOffset = 64;
+
+    static constexpr uint8_t NoStage = 0xff;
+
+    struct Record
+    {
+        uint32_t magic;
+        uint8_t stage;
+        uint8_t outerStage;
+        uint16_t stallCount;
+        uint32_t stageElapsedMs;
+        uint32_t loopElapsedMs;
+        uint32_t uptimeMs;
+        uint32_t checksum;
+    };
+
+    class Scope
+    {
+    public:
+        explicit Scope(LoopStage stage);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const uint8_t _outerStage;
+        const uint8_t _outerOuterStage;
+        const uint32_t _outerStageStartMs;
+    };
+
+    static void start();
+
+    // Should be called at the beginning of each loop iteration.
+    // Returns true if the previous iteration exceeded the budget.
+    static bool feed();
+
+    // Reads the record stored in the RTC memory
+    static bool readRecord(Record& record);
+    static void clearRecord();
+};
+
+#define WATCHDOG_CONCAT_IMPL(A, B) A##B
+#define WATCHDOG_CONCAT(A, B) WATCHDOG_CONCAT_IMPL(A, B)
+#define WATCHDOG_STAGE(STAGE) \
+    const LoopWatchdog::Scope WATCHDOG_CONCAT(_watchdogScope, __LINE__){ LoopStage::STAGE }
+
+#else
+
+#define WATCHDOG_STAGE(STAGE)
+
+#endif
@@ -0,0 +1,151 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#include "MqttDiscovery.h"
+
+#include <network/MQTT/MqttClient.h>
+
+namespace
+{
+    //
+    // JSON glue between the common members
+    //
+
+    const char IconPrefix[] PROGMEM = R"({"icon":")";
+    const char NamePrefix[] PROGMEM = R"(","name":")";
+    const char ObjectIdPrefix[] PROGMEM = R"(","object_id":")";
+    const char UniqueIdPrefix[] PROGMEM = R"(","unique_id":")";
+    const char AttributesPrefix[] PROGMEM = R"(",)";
+    const char Suffix[] PROGMEM = "}";
+
+    //
+    // HVAC accessory
+    //
+
+    const char ClimateTopic[] PROGMEM = "homeassistant/climate/thermostat/config";
+    const char ClimateIcon[] PROGMEM = "mdi:sun-thermometer";
+    const char ClimateName[] PROGMEM = "Thermostat";
+    const char ClimateObjectId[] PROGMEM = "thermostat";
+    const char ClimateAttributes[] PROGMEM =
+        R"("max_temp":30)"
+        R"(,"min_temp":10)"
+        R"(,"current_temperature_topic":"thermostat/temp/current")"
+        R"(,"mode_command_topic":"thermostat/hvac_mode/set")"
+        R"(,"mode_state_topic":"thermostat/hvac_mode")"
+        R"(,"modes":["auto","heat","off"])"
+        R"(,"precision":0.1)"
+        R"(,"temperature_command_topic":"thermostat/temp/active/set")"
+        R"(,"temperature_state_topic":"thermostat/temp/active")"
+        R"(,"temperature_high_command_topic":"thermostat/temp/daytime/set")"
+        R"(,"temperature_high_state_topic":"thermostat/temp/daytime")"
+        R"(,"temperature_low_command_topic":"thermostat/temp/nightTime/set")"
+        R"(,"temperature_low_state_topic":"thermostat/temp/nightTime")"
+        R"(,"temperature_unit":"C")"
+        R"(,"temp_step":0.5)";
+
+    //
+    // Boost buttons
+    //
+
+    const char BoostActivateTopic[] PROGMEM = "homeassistant/button/thermostat_boost_activate/config";
+    const char BoostActivateIcon[] PROGMEM = "mdi:radiator";
+    const char BoostActivateName[] PROGMEM = "Activate Boost";
+    const char BoostActivateObjectId[] PROGMEM = "thermostat_boost_activate";
+    const char BoostActivateAttributes[] PROGMEM =
+        R"("command_topic":"thermostat/boost/active/set")"
+        R"(,"payload_press":"1")";
+
+    const char BoostDeactivateTopic[] PROGMEM = "homeassistant/button/thermostat_boost_deactivate/config";
+    const char BoostDeactivateIcon[] PROGMEM = "mdi:radiator-off";
+    const char BoostDeactivateName[] PROGMEM = "Deactivate Boost";
+    const char BoostDeactivateObjectId[] PROGMEM = "thermostat_boost_deactivate";
+    const char BoostDeactivateAttributes[] PROGMEM =
+        R"("command_topic":"thermostat/boost/active/set")"
+        R"(,"payload_press":"0")";
+
+    //
+    // Boost remaining time sensor
+    //
+
+    const char BoostRemainingTopic[] PROGMEM = "homeassistant/sensor/thermostat_boost_remaining/config";
+    const char BoostRemainingIcon[] PROGMEM = "mdi:timer";
+    const char BoostRemainingName[] PROGMEM = "Boost Remaining";
+    const char BoostRemainingObjectId[] PROGMEM = "thermostat_boost_remaining";
+    const char BoostRemainingAttributes[] PROGMEM =
+        R"("state_topic":"thermostat/boost/remainingSecs")"
+        R"(,"unit_of_measurement":"s")";
+
+    const MqttDiscovery::Entity Entities[] PROGMEM = {
+        { ClimateTopic, ClimateIcon, ClimateName, ClimateObjectId, ClimateAttributes },
+        { BoostActivateTopic, BoostActivateIcon, BoostActivateName, BoostActivateObjectId, BoostActivateAttributes },
+        { BoostDeactivateTopic, BoostDeactivateIcon, BoostDeactivateName, BoostDeactivateObjectId, BoostDeactivateAttributes },
+        { BoostRemainingTopic, BoostRemainingIcon, BoostRemainingName, BoostRemainingObjectId, BoostRemainingAttributes }
+    };
+
+    void appendP(std::string& s, PGM_P str)
+    {
+        const auto offset = s.size();
+        const auto len = strlen_P(str);
+        s.resize(offset + len);
+        memcpy_P(&s[offset], str, len);
+    }
+}
+
+std::size_t MqttDiscovery::payloadLength(const Entity& entity)
+{
+    return strlen_P(IconPrefix) + strlen_P(entity.icon)
+        + strlen_P(NamePrefix) + strlen_P(entity.name)
+        + strlen_P(ObjectIdPrefix) + strlen_P(entity.objectId)
+        + strlen_P(UniqueIdPrefix) + strlen_P(entity.objectId)
+        + strlen_P(AttributesPrefix) + strlen_P(entity.attributes)
+        + strlen_P(Suffix);
+}
+
+void MqttDiscovery::buildPayload(const Entity& entity, std::string& payload)
+{
+    // Allocate once, then copy the fragments straight from the flash
+    payload.clear();
+    payload.reserve(payloadLength(entity));
+
+    appendP(payload, IconPrefix);
+    appendP(payload, entity.icon);
+    appendP(payload, NamePrefix);
+    appendP(payload, entity.name);
+    appendP(payload, ObjectIdPrefix);
+    appendP(payload, entity.objectId);
+    appendP(payload, UniqueIdPrefix);
+    appendP(payload, entity.objectId);
+    appendP(payload, AttributesPrefix);
+    appendP(payload, entity.attributes);
+    appendP(payload, Suffix);
+}
+
+void MqttDiscovery::publishAll(MqttClient& client)
+{
+    std::string payload;
+
+    for (const auto& e : Entities) {
+        Entity entity;
+        memcpy_P(&entity, &e, sizeof(entity));
+
+        buildPayload(entity, payload);
+        client.publish(entity.configTopic, payload, false);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#pragma once
+
+#include <pgmspace.h>
+
+#include <cstddef>
+#include <string>
+
+class MqttClient;
+
+namespace MqttDiscovery
+{
+    // Describes a Home Assistant entity. All strings must be in PROGMEM.
+    struct Entity
+    {
+        PGM_P configTopic;
+        PGM_P icon;
+        PGM_P name;
+
+        // Used as both "object_id" and "unique_id"
+        PGM_P objectId;
+
+        // The rest of the JSON members, without the enclosing braces
+        PGM_P attributes;
+    };
+
+    std::size_t payloadLength(const Entity& entity);
+    void buildPayload(const Entity& entity, std::string& payload);
+
+    void publishAll(MqttClient& client);
+}
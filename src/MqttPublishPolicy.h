@@ -0,0 +1,115 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Decides whether a new value of an MQTT variable is worth publishing.
+// The default configuration publishes every change immediately.
+class MqttPublishPolicy
+{
+public:
+    struct Config
+    {
+        // Changes not larger than this are held back
+        float deadband = 0;
+
+        // Minimum time between two publications
+        uint32_t minIntervalMs = 0;
+
+        // A held back change is published after this time at the latest, 0 disables it
+        uint32_t maxIntervalMs = 0;
+    };
+
+    MqttPublishPolicy() = default;
+
+    explicit MqttPublishPolicy(const Config& config)
+        : _config(config)
+    {}
+
+    // Returns true if the value should be published and records it as the last published one
+    bool shouldPublish(const float value, const uint32_t timestampMs)
+    {
+        const auto observedChange = value != _lastObservedValue;
+        _lastObservedValue = value;
+
+        if (!_forced) {
+            if (value == _lastValue) {
+                return false;
+            }
+
+            const auto elapsed = timestampMs - _lastPublishTimestamp;
+
+            if (elapsed < _config.minIntervalMs) {
+                suppress(observedChange);
+                return false;
+            }
+
+            const auto overdue = _config.maxIntervalMs > 0 && elapsed >= _config.maxIntervalMs;
+
+            if (std::fabs(value - _lastValue) <= _config.deadband && !overdue) {
+                suppress(observedChange);
+                return false;
+            }
+        }
+
+        _forced = false;
+        _lastValue = value;
+        _lastPublishTimestamp = timestampMs;
+        ++_publishedCount;
+
+        return true;
+    }
+
+    // Makes the next call of shouldPublish() return true, e.g. after reconnecting
+    void forcePublish()
+    {
+        _forced = true;
+    }
+
+    uint32_t publishedCount() const
+    {
+        return _publishedCount;
+    }
+
+    uint32_t suppressedCount() const
+    {
+        return _suppressedCount;
+    }
+
+private:
+    Config _config;
+    float _lastValue = 0;
+    float _lastObservedValue = 0;
+    uint32_t _lastPublishTimestamp = 0;
+    bool _forced = true;
+    uint32_t _publishedCount = 0;
+    uint32_t _suppressedCount = 0;
+
+    void suppress(const bool observedChange)
+    {
+        // Count the held back changes, not the repeated checks of the same value
+        if (observedChange) {
+            ++_suppressedCount;
+        }
+    }
+};
@@ -0,0 +1,118 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#include "MqttStateDocument.h"
+#include "Format.h"
+
+#include <pgmspace.h>
+
+#include <cstdio>
+
+namespace
+{
+    constexpr char StateFormat[] PROGMEM =
+        R"({"current":%s)"
+        R"(,"active":%s)"
+        R"(,"daytime":%s)"
+        R"(,"nightTime":%s)"
+        R"(,"mode":%u)"
+        R"(,"boost":%s)"
+        R"(,"boostRemainingMins":%u)"
+        R"(,"heating":%s)"
+        R"(,"next":{"state":%u,"weekday":%u,"hour":%u,"minute":%u}})";
+
+    // 12 conversions of 2 characters, replaced by at most: 4 temperatures,
+    // 2 "false" flags, boostRemainingMins "65535" and 5 uint8_t values "255"
+    constexpr std::size_t MaxLength = sizeof(StateFormat) - 1 - 12 * 2
+        + 4 * (Format::TenthsBufferSize - 1)
+        + 2 * 5
+        + 5
+        + 5 * 3;
+
+    static_assert(MaxLength <= MqttStateDocument::MaxLength, "The state document doesn't fit in the buffer");
+}
+
+bool MqttStateDocument::State::operator==(const State& o) const
+{
+    return currentTemp == o.currentTemp
+        && activeTemp == o.activeTemp
+        && daytimeTemp == o.daytimeTemp
+        && nightTimeTemp == o.nightTimeTemp
+        && mode == o.mode
+        && boostActive == o.boostActive
+        && boostRemainingMins == o.boostRemainingMins
+        && heatingActive == o.heatingActive
+        && nextTransitionState == o.nextTransitionState
+        && nextTransitionWeekday == o.nextTransitionWeekday
+        && nextTransitionHour == o.nextTransitionHour
+        && nextTransitionMinute == o.nextTransitionMinute;
+}
+
+bool MqttStateDocument::update(const State& state)
+{
+    if (_valid && state == _state) {
+        return false;
+    }
+
+    _state = state;
+    _valid = true;
+
+    serialize();
+
+    return true;
+}
+
+void MqttStateDocument::invalidate()
+{
+    _valid = false;
+}
+
+void MqttStateDocument::serialize()
+{
+    char current[Format::TenthsBufferSize];
+    char active[Format::TenthsBufferSize];
+    char daytime[Format::TenthsBufferSize];
+    char nightTime[Format::TenthsBufferSize];
+
+    Format::tenths(current, _state.currentTemp);
+    Format::tenths(active, _state.activeTemp);
+    Format::tenths(daytime, _state.daytimeTemp);
+    Format::tenths(nightTime, _state.nightTimeTemp);
+
+    const auto length = snprintf_P(
+        _buffer,
+        sizeof(_buffer),
+        StateFormat,
+        current,
+        active,
+        daytime,
+        nightTime,
+        _state.mode,
+        _state.boostActive ? "true" : "false",
+        _state.boostRemainingMins,
+        _state.heatingActive ? "true" : "false",
+        _state.nextTransitionState,
+        _state.nextTransitionWeekday,
+        _state.nextTransitionHour,
+        _state.nextTransitionMinute
+    );
+
+    _length = length < 0 ? 0 : length;
+}
@@ -0,0 +1,85 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Compact JSON document of the complete thermostat state,
+// serialized into a preallocated buffer.
+class MqttStateDocument
+{
+public:
+    // The longest document: "-3276.8" temperatures, "false" flags and
+    // the maximum of every integer, checked in MqttStateDocument.cpp
+    static constexpr std::size_t MaxLength = 201;
+    static constexpr auto BufferSize = MaxLength + 1;
+
+    struct State
+    {
+        // Temperature values in 0.1 Celsius
+        int16_t currentTemp = 0;
+        int16_t activeTemp = 0;
+        int16_t daytimeTemp = 0;
+        int16_t nightTimeTemp = 0;
+
+        uint8_t mode = 0;
+        bool boostActive = false;
+        uint16_t boostRemainingMins = 0;
+        bool heatingActive = false;
+
+        uint8_t nextTransitionState = 0;
+        uint8_t nextTransitionWeekday = 0;
+        uint8_t nextTransitionHour = 0;
+        uint8_t nextTransitionMinute = 0;
+
+        bool operator==(const State& o) const;
+        bool operator!=(const State& o) const
+        {
+            return !(*this == o);
+        }
+    };
+
+    // Serializes the state if it differs from the last one.
+    // Returns true if the document changed.
+    bool update(const State& state);
+
+    // Forces the next update() to serialize the state
+    void invalidate();
+
+    const char* json() const
+    {
+        return _buffer;
+    }
+
+    std::size_t length() const
+    {
+        return _length;
+    }
+
+private:
+    State _state;
+    bool _valid = false;
+    char _buffer[BufferSize] = { 0 };
+    std::size_t _length = 0;
+
+    void serialize();
+};
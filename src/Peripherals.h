@@ -21,10 +21,11 @@
 #pragma once
 
 #include "drivers/DS18B20.h"
+
+#ifndef THERMOSTAT_NATIVE
 #include "drivers/EERAM.h"
 #include "drivers/MCP7940N.h"
-
-#include <Arduino.h>
+#endif
 
 namespace Peripherals
 {
@@ -33,18 +34,22 @@ namespace Peripherals
         using MainTemperature = Drivers::DS18B20;
     }
 
+#ifndef THERMOSTAT_NATIVE
     namespace Clock
     {
         using Rtc = Drivers::MCP7940N;
     }
+#endif
 
     namespace Relay
     {
 
     }
 
+#ifndef THERMOSTAT_NATIVE
     namespace Storage
     {
         using EERAM = Drivers::EERAM;
     }
+#endif
 }
@@ -0,0 +1,59 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "PowerManager.h"
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+#include <algorithm>
+
+bool PowerManager::setMode(const Mode mode)
+{
+    if (mode == _mode) {
+        return false;
+    }
+
+    _mode = mode;
+
+#ifdef THERMOSTAT_DISABLE_LIGHT_SLEEP
+    _log.debug_P(PSTR("mode changed: idle=%d"), mode == Mode::Idle);
+#else
+    const auto sleepType = mode == Mode::Idle ? WIFI_LIGHT_SLEEP : WIFI_MODEM_SLEEP;
+
+    if (!WiFi.setSleepMode(sleepType)) {
+        _log.warning_P(PSTR("failed to set WiFi sleep mode: %d"), sleepType);
+    }
+
+    _log.debug_P(PSTR("mode changed: idle=%d, WiFi sleep mode: %d"), mode == Mode::Idle, sleepType);
+#endif
+
+    return true;
+}
+
+void PowerManager::sleep(const uint32_t ms)
+{
+    if (ms == 0) {
+        return;
+    }
+
+    delay(std::min(ms, MaxSleepMs));
+}
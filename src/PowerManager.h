@@ -0,0 +1,65 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <Logger.h>
+
+#include <cstdint>
+
+// Reduces the power consumption (and the self-heating near the temperature
+// sensor) between the scheduled jobs.
+//
+// While the UI is inactive, the WiFi is switched to automatic light sleep,
+// which the SDK enters during delay() and wakes up for the DTIM beacons,
+// keeping the MQTT connection alive. GPIO outputs (e.g. the relay) keep
+// their state in light sleep.
+//
+// Waking up on a key press is not possible, since column 1 of the keypad is
+// on GPIO16 which can't generate interrupts, so the keypad is polled with a
+// longer interval instead.
+class PowerManager
+{
+public:
+    enum class Mode
+    {
+        Active,
+        Idle
+    };
+
+    static constexpr uint32_t MaxSleepMs = 100;
+    static constexpr uint32_t IdleKeypadScanIntervalMs = 100;
+
+    // Returns true if the mode changed
+    bool setMode(Mode mode);
+
+    Mode mode() const
+    {
+        return _mode;
+    }
+
+    // Yields the CPU until the next job is due
+    void sleep(uint32_t ms);
+
+private:
+    Logger _log{ "PowerManager" };
+    Mode _mode = Mode::Active;
+};
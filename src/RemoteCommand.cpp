@@ -0,0 +1,84 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "RemoteCommand.h"
+#include "HeatingController.h"
+
+void RemoteCommand::apply(HeatingController& heatingController) const
+{
+    switch (type) {
+        case Type::ActiveTemp:
+            heatingController.setTargetTemp(value);
+            break;
+
+        case Type::BoostActive:
+            if (value) {
+                if (!heatingController.isBoostActive()) {
+                    heatingController.activateBoost();
+                } else {
+                    heatingController.extendBoost();
+                }
+            } else {
+                heatingController.deactivateBoost();
+            }
+            break;
+
+        case Type::DaytimeTemp:
+            heatingController.setDaytimeTemp(value);
+            break;
+
+        case Type::HeatingMode:
+            if (
+                value < static_cast<int>(HeatingController::Mode::_First)
+                || value > static_cast<int>(HeatingController::Mode::_Last)
+            ) {
+                return;
+            }
+
+            heatingController.setMode(static_cast<HeatingController::Mode>(value));
+            break;
+
+        case Type::NightTimeTemp:
+            heatingController.setNightTimeTemp(value);
+            break;
+
+        case Type::HvacMode:
+            switch (static_cast<HvacMode>(value)) {
+                case HvacMode::Off:
+                    heatingController.setMode(HeatingController::Mode::Off);
+                    break;
+
+                case HvacMode::Heat:
+                    if (!heatingController.isBoostActive()) {
+                        heatingController.activateBoost();
+                    }
+                    break;
+
+                case HvacMode::Auto:
+                    heatingController.setMode(HeatingController::Mode::Normal);
+                    break;
+            }
+            break;
+
+        case Type::_Count:
+            break;
+    }
+}
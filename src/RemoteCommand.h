@@ -0,0 +1,60 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Commands received over MQTT, applied to the heating controller.
+// Kept apart from Thermostat, so recorded traces can be replayed
+// with the same effect on the host.
+
+#include <cstdint>
+
+class HeatingController;
+
+struct RemoteCommand
+{
+    enum class Type : uint8_t
+    {
+        ActiveTemp,
+        BoostActive,
+        DaytimeTemp,
+        HeatingMode,
+        NightTimeTemp,
+        HvacMode,
+
+        _Count
+    };
+
+    // Values of the Home Assistant HVAC mode
+    enum class HvacMode : uint8_t
+    {
+        Off,
+        Heat,
+        Auto
+    };
+
+    Type type;
+
+    // Temperatures in 0.1 Celsius, booleans as 0/1
+    int16_t value;
+
+    void apply(HeatingController& heatingController) const;
+};
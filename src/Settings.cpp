@@ -19,10 +19,11 @@
 */
 
 #include "Settings.h"
-#include "HeatingController.h"
+#include "Extras.h"
+#include "LoopStage.h"
 
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <cstring>
 
 Settings::Settings(ISettingsHandler& handler)
     : _handler(handler)
@@ -55,6 +56,8 @@ bool Settings::load()
 
 bool Settings::save()
 {
+    LOOP_STAGE(SettingsSave);
+
     if (!check()) {
         _log.warning_P(PSTR("settings corrected before saving"));
     }
@@ -79,56 +82,93 @@ void Settings::loadDefaults()
     }
 }
 
-bool Settings::check()
+const Settings::FieldDescriptor& Settings::descriptor(const Field field)
 {
-    bool modified = false;
+    return SettingsFields::Table[static_cast<std::size_t>(field)];
+}
 
-    // Reset Heat Control mode if it's corrupted
-    if (data.HeatingController.Mode > static_cast<uint8_t>(HeatingController::Mode::Off)) {
-        data.HeatingController.Mode = static_cast<uint8_t>(HeatingController::Mode::Off);
-        modified = true;
-    }
+int16_t Settings::fieldValue(const Data& data, const Field field)
+{
+    const auto& desc = descriptor(field);
+    const auto p = reinterpret_cast<const uint8_t*>(&data) + desc.offset;
 
-    // If daytime temp is out of range, reset to default
-    if (data.HeatingController.DaytimeTemp > Limits::HeatingController::DaytimeTempMax || data.HeatingController.DaytimeTemp < Limits::HeatingController::DaytimeTempMin) {
-        data.HeatingController.DaytimeTemp = DefaultSettings::HeatingController::DaytimeTemp;
-        modified = true;
-    }
+    // Data is packed, the fields must be accessed byte-wise
+    switch (desc.type) {
+        case FieldDescriptor::Type::UInt8:
+            return *p;
 
-    // If nighttime temp is out of range, reset to default
-    if (data.HeatingController.NightTimeTemp > Limits::HeatingController::NightTimeTempMax || data.HeatingController.NightTimeTemp < Limits::HeatingController::NightTimeTempMin) {
-        data.HeatingController.NightTimeTemp = DefaultSettings::HeatingController::NightTimeTemp;
-        modified = true;
-    }
+        case FieldDescriptor::Type::Int8:
+            return static_cast<int8_t>(*p);
 
-    // If temperature overshoot is out of range, reset to default
-    if (data.HeatingController.Overshoot > Limits::HeatingController::TempOvershootMax || data.HeatingController.NightTimeTemp < Limits::HeatingController::TempOvershootMin) {
-        data.HeatingController.Overshoot = DefaultSettings::HeatingController::TempOvershoot;
-        modified = true;
-    }
+        case FieldDescriptor::Type::UInt16: {
+            uint16_t v;
+            memcpy(&v, p, sizeof(v));
+            return static_cast<int16_t>(std::min<uint16_t>(v, INT16_MAX));
+        }
 
-    // If temperature undershoot is out of range, reset to default
-    if (data.HeatingController.Undershoot > Limits::HeatingController::TempUndershootMax || data.HeatingController.Undershoot < Limits::HeatingController::TempUndershootMin) {
-        data.HeatingController.Undershoot = DefaultSettings::HeatingController::TempUndershoot;
-        modified = true;
+        case FieldDescriptor::Type::Int16: {
+            int16_t v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
     }
 
-    // If temperature correction is out of range, reset to default
-    if (data.HeatingController.TempCorrection > Limits::HeatingController::TempCorrectionMax || data.HeatingController.TempCorrection < Limits::HeatingController::TempCorrectionMin) {
-        data.HeatingController.TempCorrection = DefaultSettings::HeatingController::TempCorrection;
-        modified = true;
-    }
+    return 0;
+}
 
-    // If BOOST interval is out of range, reset to default
-    if (data.HeatingController.BoostIntervalMins > Limits::HeatingController::BoostIntervalMax || data.HeatingController.BoostIntervalMins < Limits::HeatingController::BoostIntervalMin) {
-        data.HeatingController.BoostIntervalMins = DefaultSettings::HeatingController::BoostInterval;
-        modified = true;
+void Settings::setFieldValue(Data& data, const Field field, const int16_t value)
+{
+    const auto& desc = descriptor(field);
+    const auto p = reinterpret_cast<uint8_t*>(&data) + desc.offset;
+
+    switch (desc.type) {
+        case FieldDescriptor::Type::UInt8:
+        case FieldDescriptor::Type::Int8:
+            *p = static_cast<uint8_t>(value);
+            break;
+
+        case FieldDescriptor::Type::UInt16:
+        case FieldDescriptor::Type::Int16:
+            memcpy(p, &value, sizeof(value));
+            break;
     }
+}
 
-    // If Custom Temperature Timeout is out of range, reset to default
-    if (data.HeatingController.CustomTempTimeoutMins > Limits::HeatingController::CustomTempTimeoutMax || data.HeatingController.CustomTempTimeoutMins < Limits::HeatingController::CustomTempTimeoutMin) {
-            data.HeatingController.CustomTempTimeoutMins = DefaultSettings::HeatingController::CustomTempTimeout;
+int16_t Settings::clampFieldValue(const Field field, const int32_t value)
+{
+    const auto& desc = descriptor(field);
+    return static_cast<int16_t>(Extras::clampValue(value, desc.min, desc.max));
+}
+
+void Settings::adjustFieldValue(Data& data, const Field field, const int8_t amount)
+{
+    const auto& desc = descriptor(field);
+
+    setFieldValue(
+        data,
+        field,
+        Extras::adjustValueWithRollOver(
+            static_cast<int32_t>(fieldValue(data, field)),
+            amount,
+            desc.min,
+            desc.max
+        )
+    );
+}
+
+bool Settings::check()
+{
+    bool modified = false;
+
+    // Reset the fields to their defaults if they're out of range
+    for (const auto& desc : SettingsFields::Table) {
+        const auto value = fieldValue(data, desc.field);
+
+        if (value < desc.min || value > desc.max) {
+            _log.warning_P(PSTR("field out of range: field=%u, value=%d"), static_cast<unsigned>(desc.field), value);
+            setFieldValue(data, desc.field, desc.defaultValue);
             modified = true;
+        }
     }
 
     // If there was a correction, assume that the settings data is
@@ -164,22 +204,33 @@ void Settings::dumpData() const
         data.HeatingController.CustomTempTimeoutMins
     );
 
-    std::stringstream schDays;
-    for (auto i = 0; i < 7; ++i) {
-        schDays << std::to_string(i) << "=";
-        schDays << std::hex << std::setw(2) << std::setfill('0');
-        for (auto j = 0; j < 6; ++j) {
-             schDays << static_cast<int>(data.Scheduler.DayData[i][j]);
+    // Formatted in place to avoid heap allocations: "0=xxxxxxxxxxxxh, 1=..."
+    static constexpr auto DayCount = sizeof(data.Scheduler.DayData) / sizeof(data.Scheduler.DayData[0]);
+    static constexpr auto DayTextLength = 2 + sizeof(SchedulerDayData) * 2 + 1;
+    static const char HexDigits[] = "0123456789abcdef";
+
+    char schDays[DayCount * (DayTextLength + 2)];
+    auto p = schDays;
+
+    for (auto i = 0u; i < DayCount; ++i) {
+        *p++ = '0' + i;
+        *p++ = '=';
+        for (const auto b : data.Scheduler.DayData[i]) {
+            *p++ = HexDigits[b >> 4];
+            *p++ = HexDigits[b & 0xf];
         }
-        schDays << std::resetiosflags << 'h';
-        if (i < 6) {
-            schDays << ", ";
+        *p++ = 'h';
+        if (i < DayCount - 1) {
+            *p++ = ',';
+            *p++ = ' ';
         }
     }
 
+    *p = 0;
+
     _log.debug("Scheduler{ Enabled=%u, Days=[ %s ] }",
         data.Scheduler.Enabled,
-        schDays.str().c_str()
+        schDays
     );
 
     _log.debug("Extra{ DisableBlynk=%u }",
@@ -23,6 +23,7 @@
 #include <ISettingsHandler.h>
 #include <Logger.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 
@@ -38,6 +39,9 @@ namespace Limits
 
     namespace HeatingController
     {
+        // HeatingController::Mode::_First and _Last, checked in HeatingController.h
+        constexpr auto ModeMin = 0;
+        constexpr auto ModeMax = 2;
         constexpr auto DaytimeTempMax = MaximumTemperature;
         constexpr auto DaytimeTempMin = MinimumTemperature;
         constexpr auto NightTimeTempMax = MaximumTemperature;
@@ -53,13 +57,24 @@ namespace Limits
         constexpr auto CustomTempTimeoutMin = 0;
         constexpr auto CustomTempTimeoutMax = 1440;
     }
+
+    namespace Display
+    {
+        constexpr auto BrightnessMin = 0;
+        constexpr auto BrightnessMax = 255;
+        constexpr auto TimeoutSecsMin = 0;
+        constexpr auto TimeoutSecsMax = 255;
+    }
 }
 
 namespace DefaultSettings
 {
     namespace HeatingController
     {
+        // HeatingController::Mode::Normal and Off, checked in HeatingController.h
         constexpr auto Mode = 0;
+        constexpr auto FallbackMode = 2;
+
         constexpr auto DaytimeTemp = 220;
         constexpr auto NightTimeTemp = 200;
         constexpr auto TargetTemp = NightTimeTemp;
@@ -137,6 +152,53 @@ public:
 
     Data data;
 
+    enum class Field : uint8_t
+    {
+        HeatingControllerMode,
+        DaytimeTemp,
+        NightTimeTemp,
+        TempOvershoot,
+        TempUndershoot,
+        TempCorrection,
+        BoostIntervalMins,
+        CustomTempTimeoutMins,
+        DisplayBrightness,
+        DisplayTimeoutSecs,
+
+        _Count
+    };
+
+    struct FieldDescriptor
+    {
+        enum class Type : uint8_t
+        {
+            UInt8,
+            Int8,
+            UInt16,
+            Int16
+        };
+
+        Field field;
+        uint16_t offset;
+        Type type;
+        int16_t min;
+        int16_t max;
+
+        // Value used when the stored one is out of range
+        int16_t defaultValue;
+    };
+
+    template <typename T>
+    static constexpr FieldDescriptor::Type fieldTypeOf();
+
+    static const FieldDescriptor& descriptor(Field field);
+
+    static int16_t fieldValue(const Data& data, Field field);
+    static void setFieldValue(Data& data, Field field, int16_t value);
+
+    static int16_t clampFieldValue(Field field, int32_t value);
+    static void adjustFieldValue(Data& data, Field field, int8_t amount);
+
     bool load();
     bool save();
 
@@ -150,3 +212,60 @@ private:
 
     void dumpData() const;
 };
+
+template <> constexpr Settings::FieldDescriptor::Type Settings::fieldTypeOf<uint8_t>() { return FieldDescriptor::Type::UInt8; }
+template <> constexpr Settings::FieldDescriptor::Type Settings::fieldTypeOf<int8_t>() { return FieldDescriptor::Type::Int8; }
+template <> constexpr Settings::FieldDescriptor::Type Settings::fieldTypeOf<uint16_t>() { return FieldDescriptor::Type::UInt16; }
+template <> constexpr Settings::FieldDescriptor::Type Settings::fieldTypeOf<int16_t>() { return FieldDescriptor::Type::Int16; }
+
+#define SETTINGS_FIELD(_FIELD, _GROUP, _MEMBER, _MIN, _MAX, _DEFAULT) \
+    Settings::FieldDescriptor{ \
+        Settings::Field::_FIELD, \
+        offsetof(Settings::Data, _GROUP._MEMBER), \
+        Settings::fieldTypeOf<decltype(Settings::_GROUP##Settings::_MEMBER)>(), \
+        _MIN, \
+        _MAX, \
+        _DEFAULT \
+    }
+
+namespace SettingsFields
+{
+    namespace L = Limits::HeatingController;
+    namespace D = DefaultSettings::HeatingController;
+
+    // Single source of the valid ranges of the settings.
+    // Settings::check(), the menu value adjusters and the remote setters
+    // all derive their bounds from this table.
+    constexpr Settings::FieldDescriptor Table[] = {
+        // A corrupted mode falls back to Off instead of the factory default
+        SETTINGS_FIELD(HeatingControllerMode,   HeatingController,  Mode,                   L::ModeMin,                 L::ModeMax,                 D::FallbackMode),
+        SETTINGS_FIELD(DaytimeTemp,             HeatingController,  DaytimeTemp,            L::DaytimeTempMin,          L::DaytimeTempMax,          D::DaytimeTemp),
+        SETTINGS_FIELD(NightTimeTemp,           HeatingController,  NightTimeTemp,          L::NightTimeTempMin,        L::NightTimeTempMax,        D::NightTimeTemp),
+        SETTINGS_FIELD(TempOvershoot,           HeatingController,  Overshoot,              L::TempOvershootMin,        L::TempOvershootMax,        D::TempOvershoot),
+        SETTINGS_FIELD(TempUndershoot,          HeatingController,  Undershoot,             L::TempUndershootMin,       L::TempUndershootMax,       D::TempUndershoot),
+        SETTINGS_FIELD(TempCorrection,          HeatingController,  TempCorrection,         L::TempCorrectionMin,       L::TempCorrectionMax,       D::TempCorrection),
+        SETTINGS_FIELD(BoostIntervalMins,       HeatingController,  BoostIntervalMins,      L::BoostIntervalMin,        L::BoostIntervalMax,        D::BoostInterval),
+        SETTINGS_FIELD(CustomTempTimeoutMins,   HeatingController,  CustomTempTimeoutMins,  L::CustomTempTimeoutMin,    L::CustomTempTimeoutMax,    D::CustomTempTimeout),
+        SETTINGS_FIELD(DisplayBrightness,       Display,            Brightness,             Limits::Display::BrightnessMin,     Limits::Display::BrightnessMax,     DefaultSettings::Display::Brightness),
+        SETTINGS_FIELD(DisplayTimeoutSecs,      Display,            TimeoutSecs,            Limits::Display::TimeoutSecsMin,    Limits::Display::TimeoutSecsMax,    DefaultSettings::Display::TimeoutSecs)
+    };
+
+    constexpr auto Count = sizeof(Table) / sizeof(Table[0]);
+
+    constexpr bool isValid(const std::size_t index = 0)
+    {
+        return index >= Count
+            || (
+                static_cast<std::size_t>(Table[index].field) == index
+                && Table[index].min <= Table[index].max
+                && Table[index].defaultValue >= Table[index].min
+                && Table[index].defaultValue <= Table[index].max
+                && isValid(index + 1)
+            );
+    }
+
+    static_assert(Count == static_cast<std::size_t>(Settings::Field::_Count), "Settings field table is incomplete");
+    static_assert(isValid(), "Settings field table must be ordered by Field and have consistent limits");
+}
+
+#undef SETTINGS_FIELD
@@ -0,0 +1,83 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <cstdint>
+
+// Lock-free single producer, single consumer queue.
+// The producer can be an interrupt handler, push() is always inlined,
+// so it can be called from IRAM code.
+template <typename T, uint8_t Size>
+class SpscQueue
+{
+    static_assert(Size > 0 && (Size & (Size - 1)) == 0, "Size must be a power of two");
+    static_assert(Size <= 128, "Size must fit the 8-bit indices");
+
+public:
+    inline __attribute__((always_inline)) bool push(const T& item)
+    {
+        const uint8_t head = _head;
+
+        if (static_cast<uint8_t>(head - _tail) == Size) {
+            return false;
+        }
+
+        _items[head & Mask] = item;
+
+        // The item must be written before it's published
+        __asm__ __volatile__("" ::: "memory");
+
+        _head = head + 1;
+
+        return true;
+    }
+
+    bool pop(T& item)
+    {
+        const uint8_t tail = _tail;
+
+        if (tail == _head) {
+            return false;
+        }
+
+        item = _items[tail & Mask];
+
+        // The item must be read before its slot is released
+        __asm__ __volatile__("" ::: "memory");
+
+        _tail = tail + 1;
+
+        return true;
+    }
+
+    bool isEmpty() const
+    {
+        return _head == _tail;
+    }
+
+private:
+    static constexpr uint8_t Mask = Size - 1;
+
+    T _items[Size];
+    volatile uint8_t _head = 0;
+    volatile uint8_t _tail = 0;
+};
@@ -0,0 +1,219 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#include "TaskScheduler.h"
+#include "hal/Time.h"
+
+#include <algorithm>
+#include <iterator>
+
+TaskScheduler::TaskScheduler()
+{
+    std::fill(std::begin(_slots), std::end(_slots), NoJob);
+}
+
+TaskScheduler::JobId TaskScheduler::schedulePeriodic(const uint32_t intervalMs, Job job)
+{
+    return add(intervalMs, std::max<uint32_t>(intervalMs, 1), std::move(job));
+}
+
+TaskScheduler::JobId TaskScheduler::scheduleOnce(const uint32_t delayMs, Job job)
+{
+    return add(delayMs, 0, std::move(job));
+}
+
+void TaskScheduler::cancel(const JobId id)
+{
+    if (id >= MaxJobs || !_entries[id].active) {
+        return;
+    }
+
+    unlink(id);
+    _entries[id].active = false;
+    _entries[id].job = nullptr;
+}
+
+void TaskScheduler::setInterval(const JobId id, const uint32_t intervalMs)
+{
+    if (id >= MaxJobs || !_entries[id].active) {
+        return;
+    }
+
+    auto& entry = _entries[id];
+
+    const auto intervalTicks = msToTicks(intervalMs);
+
+    if (entry.intervalTicks == intervalTicks) {
+        return;
+    }
+
+    unlink(id);
+    entry.intervalTicks = intervalTicks;
+    entry.dueTick = _currentTick + intervalTicks;
+    insert(id);
+}
+
+void TaskScheduler::task()
+{
+    run(Hal::Time::millis());
+}
+
+void TaskScheduler::run(const uint32_t timestamp)
+{
+    if (!_started) {
+        _started = true;
+        _lastTimestamp = timestamp;
+    }
+
+    // Ticks are counted relative to the last run to handle the wrap-around of millis()
+    const auto elapsedTicks = (timestamp - _lastTimestamp) / TickMs;
+
+    if (elapsedTicks == 0) {
+        return;
+    }
+
+    _lastTimestamp += elapsedTicks * TickMs;
+
+    const auto previousTick = _currentTick;
+    _currentTick += elapsedTicks;
+
+    // Collect the due jobs first, so the jobs can safely modify the schedule
+    uint8_t ready[MaxJobs];
+    uint8_t readyCount = 0;
+
+    const auto slotsToVisit = std::min<uint32_t>(elapsedTicks, SlotCount);
+
+    for (uint32_t i = 1; i <= slotsToVisit; ++i) {
+        auto index = _slots[(previousTick + i) % SlotCount];
+
+        while (index != NoJob) {
+            const auto next = _entries[index].next;
+
+            if (static_cast<int32_t>(_currentTick - _entries[index].dueTick) >= 0) {
+                unlink(index);
+                ready[readyCount++] = index;
+            }
+
+            index = next;
+        }
+    }
+
+    for (uint8_t i = 0; i < readyCount; ++i) {
+        const auto index = ready[i];
+        auto& entry = _entries[index];
+
+        // Cancelled or rescheduled by a previous job
+        if (!entry.active || static_cast<int32_t>(_currentTick - entry.dueTick) < 0) {
+            continue;
+        }
+
+        if (entry.intervalTicks > 0) {
+            entry.dueTick += entry.intervalTicks;
+
+            // Skip the missed runs instead of running them in a burst
+            if (static_cast<int32_t>(_currentTick - entry.dueTick) >= 0) {
+                entry.dueTick = _currentTick + entry.intervalTicks;
+            }
+
+            insert(index);
+
+            entry.job();
+        } else {
+            // Move the job out, it may schedule a new one into the same entry
+            const auto job = std::move(entry.job);
+            entry.job = nullptr;
+            entry.active = false;
+
+            job();
+        }
+    }
+}
+
+uint32_t TaskScheduler::msUntilNextJob() const
+{
+    uint32_t ticks = UINT32_MAX;
+
+    for (const auto& entry : _entries) {
+        if (!entry.active) {
+            continue;
+        }
+
+        const auto remaining = static_cast<int32_t>(entry.dueTick - _currentTick);
+        ticks = std::min<uint32_t>(ticks, std::max<int32_t>(remaining, 0));
+    }
+
+    if (ticks == UINT32_MAX) {
+        return UINT32_MAX;
+    }
+
+    const auto sinceLastTick = Hal::Time::millis() - _lastTimestamp;
+    const auto ms = ticks * TickMs;
+
+    return ms > sinceLastTick ? ms - sinceLastTick : 0;
+}
+
+TaskScheduler::JobId TaskScheduler::add(const uint32_t delayMs, const uint32_t intervalMs, Job&& job)
+{
+    for (uint8_t i = 0; i < MaxJobs; ++i) {
+        auto& entry = _entries[i];
+
+        if (entry.active) {
+            continue;
+        }
+
+        entry.job = std::move(job);
+        entry.active = true;
+        entry.intervalTicks = intervalMs > 0 ? msToTicks(intervalMs) : 0;
+        entry.dueTick = _currentTick + msToTicks(delayMs);
+        insert(i);
+
+        return i;
+    }
+
+    return InvalidJobId;
+}
+
+void TaskScheduler::insert(const uint8_t index)
+{
+    auto& slot = _slots[_entries[index].dueTick % SlotCount];
+    _entries[index].next = slot;
+    slot = index;
+}
+
+void TaskScheduler::unlink(const uint8_t index)
+{
+    auto* link = &_slots[_entries[index].dueTick % SlotCount];
+
+    while (*link != NoJob) {
+        if (*link == index) {
+            *link = _entries[index].next;
+            _entries[index].next = NoJob;
+            return;
+        }
+
+        link = &_entries[*link].next;
+    }
+}
+
+uint32_t TaskScheduler::msToTicks(const uint32_t ms)
+{
+    // Rounded up, jobs never run earlier than requested
+    return std::max<uint32_t>((ms + TickMs - 1) / TickMs, 1);
+}
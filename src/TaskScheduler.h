@@ -0,0 +1,85 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// Cooperative scheduler for periodic and one-shot jobs, based on a hashed
+// timer wheel. Jobs are placed into the slot of their due tick, so running
+// the scheduler only visits the slots which elapsed since the last call.
+class TaskScheduler
+{
+public:
+    using Job = std::function<void()>;
+    using JobId = uint8_t;
+
+    static constexpr JobId InvalidJobId = 0xff;
+    static constexpr auto MaxJobs = 8;
+    static constexpr auto SlotCount = 64;
+    static constexpr uint32_t TickMs = 5;
+
+    TaskScheduler();
+
+    // Runs the job every intervalMs, first after the interval elapsed
+    JobId schedulePeriodic(uint32_t intervalMs, Job job);
+
+    // Runs the job once after delayMs
+    JobId scheduleOnce(uint32_t delayMs, Job job);
+
+    void cancel(JobId id);
+
+    // Changes the interval of a periodic job, the next run is rescheduled
+    // relative to the current time
+    void setInterval(JobId id, uint32_t intervalMs);
+
+    void task();
+    void run(uint32_t timestamp);
+
+    // Time until the earliest job is due, or UINT32_MAX if there are no jobs
+    uint32_t msUntilNextJob() const;
+
+private:
+    static constexpr uint8_t NoJob = 0xff;
+
+    struct Entry
+    {
+        Job job;
+        uint32_t dueTick = 0;
+        uint32_t intervalTicks = 0;
+        uint8_t next = NoJob;
+        bool active = false;
+    };
+
+    Entry _entries[MaxJobs];
+    uint8_t _slots[SlotCount];
+
+    uint32_t _currentTick = 0;
+    uint32_t _lastTimestamp = 0;
+    bool _started = false;
+
+    JobId add(uint32_t delayMs, uint32_t intervalMs, Job&& job);
+    void insert(uint8_t index);
+    void unlink(uint8_t index);
+
+    static uint32_t msToTicks(uint32_t ms);
+};
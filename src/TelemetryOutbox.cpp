@@ -0,0 +1,109 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "TelemetryOutbox.h"
+#include "Extras.h"
+#include "Format.h"
+
+#include <pgmspace.h>
+
+#include <algorithm>
+#include <cstdio>
+
+void TelemetryOutbox::push(const Entry& entry)
+{
+    if (!Extras::isTimeSynchronized(entry.timestamp)) {
+        return;
+    }
+
+    if (_size == Capacity) {
+        _first = (_first + 1) % Capacity;
+        --_size;
+        ++_overflowCount;
+    }
+
+    _entries[(_first + _size) % Capacity] = entry;
+    ++_size;
+}
+
+void TelemetryOutbox::clear()
+{
+    _first = 0;
+    _size = 0;
+}
+
+std::size_t TelemetryOutbox::drain(const PublishFunction& publish)
+{
+    if (_size == 0) {
+        return 0;
+    }
+
+    const auto count = std::min(_size, BatchSize);
+    const auto length = serializeBatch(count);
+
+    if (!publish(_buffer, length)) {
+        return 0;
+    }
+
+    _first = (_first + count) % Capacity;
+    _size -= count;
+
+    return count;
+}
+
+std::size_t TelemetryOutbox::serializeBatch(const std::size_t count)
+{
+    char current[Format::TenthsBufferSize];
+    char target[Format::TenthsBufferSize];
+
+    std::size_t length = 0;
+    _buffer[length++] = '[';
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& entry = _entries[(_first + i) % Capacity];
+
+        Format::tenths(current, entry.currentTemp);
+        Format::tenths(target, entry.targetTemp);
+
+        const auto written = snprintf_P(
+            _buffer + length,
+            sizeof(_buffer) - length,
+            PSTR(R"(%s{"ts":%u,"current":%s,"target":%s,"heating":%s,"boost":%s})"),
+            i > 0 ? "," : "",
+            entry.timestamp,
+            current,
+            target,
+            entry.heatingActive ? "true" : "false",
+            entry.boostActive ? "true" : "false"
+        );
+
+        if (written < 0) {
+            break;
+        }
+
+        length = std::min<std::size_t>(length + written, sizeof(_buffer) - 2);
+    }
+
+    _buffer[length++] = ']';
+    _buffer[length] = 0;
+
+    return length;
+}
@@ -0,0 +1,99 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#ifndef THERMOSTAT_TELEMETRY_OUTBOX_SIZE
+// 4 hours of samples taken once a minute
+#define THERMOSTAT_TELEMETRY_OUTBOX_SIZE 240
+#endif
+
+// Bounded queue of timestamped state samples collected while the MQTT
+// connection is down. After reconnecting, the queue is drained in small
+// batches to avoid flooding the network stack.
+class TelemetryOutbox
+{
+public:
+    static constexpr std::size_t Capacity = THERMOSTAT_TELEMETRY_OUTBOX_SIZE;
+    static constexpr std::size_t BatchSize = 4;
+    static constexpr uint32_t BatchIntervalMs = 250;
+    static constexpr auto SampleIntervalSecs = 60;
+
+    static_assert(Capacity > 0, "Outbox capacity must be positive");
+
+    struct Entry
+    {
+        uint32_t timestamp = 0;
+
+        // Values in 0.1 Celsius
+        int16_t currentTemp = 0;
+        int16_t targetTemp = 0;
+
+        bool heatingActive = false;
+        bool boostActive = false;
+    };
+
+    // Should return false if the payload couldn't be sent.
+    // Unsent entries are kept for the next batch.
+    using PublishFunction = std::function<bool(const char* payload, std::size_t length)>;
+
+    // Adds an entry, dropping the oldest one if the outbox is full.
+    // Entries taken before the clock was synchronized are ignored.
+    void push(const Entry& entry);
+    void clear();
+
+    // Publishes the next batch, should be called every BatchIntervalMs.
+    // Returns the number of entries sent.
+    std::size_t drain(const PublishFunction& publish);
+
+    bool isEmpty() const
+    {
+        return _size == 0;
+    }
+
+    std::size_t size() const
+    {
+        return _size;
+    }
+
+    uint32_t overflowCount() const
+    {
+        return _overflowCount;
+    }
+
+private:
+    // {"ts":4294967295,"current":-3276.8,"target":-3276.8,"heating":false,"boost":false}
+    static constexpr auto MaxEntryLength = 84;
+    static constexpr auto BufferSize = BatchSize * (MaxEntryLength + 1) + 3;
+
+    Entry _entries[Capacity];
+    std::size_t _first = 0;
+    std::size_t _size = 0;
+    uint32_t _overflowCount = 0;
+
+    char _buffer[BufferSize] = { 0 };
+
+    std::size_t serializeBatch(std::size_t count);
+};
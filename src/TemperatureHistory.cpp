@@ -0,0 +1,262 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#include "Extras.h"
+#include "TemperatureHistory.h"
+
+#include <cstring>
+
+namespace
+{
+    constexpr auto TemperatureDeltaMin = -128;
+    constexpr auto TemperatureDeltaMax = 127;
+    constexpr auto SetpointDeltaMin = -64;
+    constexpr auto SetpointDeltaMax = 63;
+    constexpr uint16_t RelayFlag = 1 << 15;
+
+    int8_t temperatureDelta(const uint16_t delta)
+    {
+        return static_cast<int8_t>(delta & 0xff);
+    }
+
+    int8_t setpointDelta(const uint16_t delta)
+    {
+        // Sign-extend the 7-bit value
+        return static_cast<int8_t>(((delta >> 8) & 0x7f) << 1) >> 1;
+    }
+}
+
+void TemperatureHistory::append(
+    const std::time_t timestamp,
+    const int16_t temperature,
+    const int16_t setpoint,
+    const bool relayActive
+)
+{
+    // Boot-relative timestamps would start a bogus block when the clock is set
+    if (!Extras::isTimeSynchronized(timestamp)) {
+        return;
+    }
+
+    if (_used > 0) {
+        auto& block = _blocks[_head];
+
+        const auto expected = static_cast<std::time_t>(block.timestamp) + block.count * SampleIntervalSecs;
+        const auto diff = timestamp - expected;
+
+        // Continue the current block if the sample is in sequence
+        if (block.count < SamplesPerBlock && diff > -SampleIntervalSecs / 2 && diff < SampleIntervalSecs / 2) {
+            const auto dt = Extras::clampValue(temperature - _lastTemperature, TemperatureDeltaMin, TemperatureDeltaMax);
+            const auto ds = Extras::clampValue(setpoint - _lastSetpoint, SetpointDeltaMin, SetpointDeltaMax);
+
+            _lastTemperature += dt;
+            _lastSetpoint += ds;
+
+            block.deltas[block.count - 1] =
+                static_cast<uint8_t>(dt)
+                | static_cast<uint16_t>((ds & 0x7f) << 8)
+                | (relayActive ? RelayFlag : 0);
+
+            ++block.count;
+
+            return;
+        }
+    }
+
+    startBlock(timestamp, temperature, setpoint, relayActive);
+}
+
+void TemperatureHistory::clear()
+{
+    _head = 0;
+    _used = 0;
+}
+
+std::size_t TemperatureHistory::sampleCount() const
+{
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < _used; ++i) {
+        count += blockAt(i).count;
+    }
+
+    return count;
+}
+
+std::time_t TemperatureHistory::oldestTimestamp() const
+{
+    if (_used == 0) {
+        return 0;
+    }
+
+    return blockAt(0).timestamp;
+}
+
+std::time_t TemperatureHistory::newestTimestamp() const
+{
+    if (_used == 0) {
+        return 0;
+    }
+
+    const auto& block = _blocks[_head];
+
+    return static_cast<std::time_t>(block.timestamp) + (block.count - 1) * SampleIntervalSecs;
+}
+
+std::size_t TemperatureHistory::query(
+    const std::time_t from,
+    const std::time_t to,
+    Sample* const samples,
+    const std::size_t maxCount
+) const
+{
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < _used && count < maxCount; ++i) {
+        const auto& block = blockAt(i);
+
+        const auto first = static_cast<std::time_t>(block.timestamp);
+        const auto last = first + (block.count - 1) * SampleIntervalSecs;
+
+        if (last < from) {
+            continue;
+        }
+
+        if (first > to) {
+            break;
+        }
+
+        auto sample = firstSample(block);
+
+        for (std::size_t j = 0; j < block.count && count < maxCount; ++j) {
+            if (j > 0) {
+                applyDelta(sample, block.deltas[j - 1]);
+            }
+
+            if (sample.timestamp > to) {
+                return count;
+            }
+
+            if (sample.timestamp >= from) {
+                samples[count++] = sample;
+            }
+        }
+    }
+
+    return count;
+}
+
+std::size_t TemperatureHistory::chunkCount() const
+{
+    return _used;
+}
+
+std::size_t TemperatureHistory::readChunk(
+    const std::size_t index,
+    uint8_t* const buffer,
+    const std::size_t size
+) const
+{
+    if (index >= _used || size < ChunkSize) {
+        return 0;
+    }
+
+    memcpy(buffer, &blockAt(index), ChunkSize);
+
+    return ChunkSize;
+}
+
+std::size_t TemperatureHistory::decodeBlock(
+    const Block& block,
+    Sample* const samples,
+    const std::size_t maxCount
+)
+{
+    std::size_t count = 0;
+
+    auto sample = firstSample(block);
+
+    for (std::size_t i = 0; i < block.count && count < maxCount; ++i) {
+        if (i > 0) {
+            applyDelta(sample, block.deltas[i - 1]);
+        }
+
+        samples[count++] = sample;
+    }
+
+    return count;
+}
+
+TemperatureHistory::Sample TemperatureHistory::firstSample(const Block& block)
+{
+    Sample sample;
+    sample.timestamp = block.timestamp;
+    sample.temperature = block.temperature;
+    sample.setpoint = block.setpoint;
+    sample.relayActive = block.relayActive != 0;
+
+    return sample;
+}
+
+void TemperatureHistory::applyDelta(Sample& sample, const uint16_t delta)
+{
+    sample.timestamp += SampleIntervalSecs;
+    sample.temperature += temperatureDelta(delta);
+    sample.setpoint += setpointDelta(delta);
+    sample.relayActive = (delta & RelayFlag) != 0;
+}
+
+const TemperatureHistory::Block& TemperatureHistory::blockAt(const std::size_t index) const
+{
+    // Index 0 is the oldest block
+    return _blocks[(_head + BlockCount - _used + 1 + index) % BlockCount];
+}
+
+void TemperatureHistory::startBlock(
+    const uint32_t timestamp,
+    const int16_t temperature,
+    const int16_t setpoint,
+    const bool relayActive
+)
+{
+    // Boot-relative timestamps would start a bogus block when the clock is set
+    if (!Extras::isTimeSynchronized(timestamp)) {
+        return;
+    }
+
+    if (_used > 0) {
+        _head = (_head + 1) % BlockCount;
+    }
+
+    if (_used < BlockCount) {
+        ++_used;
+    }
+
+    auto& block = _blocks[_head];
+
+    block.timestamp = timestamp;
+    block.temperature = temperature;
+    block.setpoint = setpoint;
+    block.relayActive = relayActive ? 1 : 0;
+    block.count = 1;
+
+    _lastTemperature = temperature;
+    _lastSetpoint = setpoint;
+}
@@ -0,0 +1,100 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+// Fixed-size history of the temperature, the set point and the relay state.
+//
+// Samples are stored in blocks of one hour. The first sample of a block is
+// stored as is, the rest are encoded as 16-bit deltas:
+//  - bits 0-7: temperature delta (-128..127 in 0.1 Celsius)
+//  - bits 8-14: set point delta (-64..63 in 0.1 Celsius)
+//  - bit 15: relay state
+// Deltas are calculated from the previously encoded value, so a saturated
+// delta is corrected by the following samples.
+class TemperatureHistory
+{
+public:
+    static constexpr auto SampleIntervalSecs = 60;
+    static constexpr auto SamplesPerBlock = 60;
+
+    // 48 hours plus the block being filled
+    static constexpr auto BlockCount = 49;
+
+    struct Sample
+    {
+        std::time_t timestamp = 0;
+
+        // Values in 0.1 Celsius
+        int16_t temperature = 0;
+        int16_t setpoint = 0;
+
+        bool relayActive = false;
+    };
+
+    struct Block
+    {
+        uint32_t timestamp;
+        int16_t temperature;
+        int16_t setpoint;
+        uint8_t relayActive;
+        uint8_t count;
+        uint16_t deltas[SamplesPerBlock - 1];
+    };
+
+    static constexpr auto ChunkSize = sizeof(Block);
+
+    // Samples taken before the clock was synchronized are ignored
+    void append(std::time_t timestamp, int16_t temperature, int16_t setpoint, bool relayActive);
+    void clear();
+
+    std::size_t sampleCount() const;
+    std::time_t oldestTimestamp() const;
+    std::time_t newestTimestamp() const;
+
+    // Copies the samples in the [from, to] interval into the output buffer,
+    // oldest first. Returns the number of the copied samples.
+    std::size_t query(std::time_t from, std::time_t to, Sample* samples, std::size_t maxCount) const;
+
+    // Raw encoded blocks for exporting the history, oldest first
+    std::size_t chunkCount() const;
+    std::size_t readChunk(std::size_t index, uint8_t* buffer, std::size_t size) const;
+
+    static std::size_t decodeBlock(const Block& block, Sample* samples, std::size_t maxCount);
+
+private:
+    Block _blocks[BlockCount];
+
+    std::size_t _head = 0;
+    std::size_t _used = 0;
+
+    int16_t _lastTemperature = 0;
+    int16_t _lastSetpoint = 0;
+
+    static Sample firstSample(const Block& block);
+    static void applyDelta(Sample& sample, uint16_t delta);
+
+    const Block& blockAt(std::size_t index) const;
+    void startBlock(uint32_t timestamp, int16_t temperature, int16_t setpoint, bool relayActive);
+};
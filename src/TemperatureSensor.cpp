@@ -21,8 +21,9 @@
 #include "Peripherals.h"
 #include "Settings.h"
 #include "TemperatureSensor.h"
+#include "TraceRecorder.h"
 
-#include <Arduino.h>
+#include <algorithm>
 
 TemperatureSensor::TemperatureSensor(const Settings& settings)
     : _settings(settings)
@@ -30,10 +31,9 @@ TemperatureSensor::TemperatureSensor(const Settings& settings)
 
 void TemperatureSensor::task()
 {
-    if (_lastUpdate == 0 || millis() - _lastUpdate >= UpdateIntervalMs) {
-        _lastUpdate = millis();
-        Peripherals::Sensors::MainTemperature::update();
-    }
+    Peripherals::Sensors::MainTemperature::update();
+
+    TraceRecorder::recordSensorReading(Peripherals::Sensors::MainTemperature::lastReading());
 }
 
 int16_t TemperatureSensor::read() const
@@ -37,5 +37,4 @@ public:
 
 private:
     const Settings& _settings;
-    uint32_t _lastUpdate = 0;
 };
\ No newline at end of file
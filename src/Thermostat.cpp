@@ -1,11 +1,15 @@
 #include "display/Display.h"
 #include "Extras.h"
+#include "MqttDiscovery.h"
 #include "Settings.h"
 #include "Thermostat.h"
+#include "Trace.h"
+#include "TraceRecorder.h"
 
 #include <Arduino.h>
 
-#include <sstream>
+#include <algorithm>
+#include <cstring>
 
 Thermostat::Thermostat(const ApplicationConfig& appConfig)
     : _coreApplication(appConfig)
@@ -13,19 +17,43 @@ Thermostat::Thermostat(const ApplicationConfig& appConfig)
     , _settings(_coreApplication.settings())
     , _temperatureSensor(_settings)
     , _heatingController(_settings, _coreApplication.systemClock(), _temperatureSensor)
-    , _ui(_settings, _coreApplication.systemClock(), _keypad, _heatingController, _temperatureSensor)
+    , _ui(_settings, _coreApplication.systemClock(), _keypad, _heatingController, _temperatureSensor, _temperatureHistory)
 #ifdef IOT_ENABLE_BLYNK
     , _blynk(_coreApplication.blynkHandler(), _heatingController, _ui, _settings)
 #endif
     , _mqtt(_coreApplication)
     , _mqttAccessory(_coreApplication)
 {
+    _keypadJobId = _scheduler.schedulePeriodic(Keypad::ScanIntervalMs, [this] {
+        {
+            LOOP_STAGE(UiTask);
+            _ui.task();
+        }
+
+        updatePowerMode();
+    });
+
+    _scheduler.schedulePeriodic(TemperatureSensor::UpdateIntervalMs, [this] {
+        LOOP_STAGE(TemperatureSensor);
+        _temperatureSensor.task();
+    });
+
+    _scheduler.schedulePeriodic(SlowLoopUpdateIntervalMs, [this] {
+        slowLoopTask();
+    });
+
     if (_appConfig.mqtt.enabled) {
         setupMqtt();
 
         _coreApplication.setMqttUpdateHandler([this] {
+            LOOP_STAGE(MqttPublish);
             updateMqtt();
         });
+
+        _scheduler.schedulePeriodic(TelemetryOutbox::BatchIntervalMs, [this] {
+            LOOP_STAGE(MqttPublish);
+            drainTelemetryOutbox();
+        });
     }
 
 #ifdef IOT_ENABLE_BLYNK
@@ -35,11 +63,30 @@ Thermostat::Thermostat(const ApplicationConfig& appConfig)
         });
     }
 #endif
+
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+    if (LoopWatchdog::readRecord(_watchdogRecord)) {
+        _watchdogRecordPending = true;
+        logWatchdogRecord();
+    }
+
+    LoopWatchdog::start();
+#endif
 }
 
 void Thermostat::task()
 {
-    _coreApplication.task();
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+    if (LoopWatchdog::feed() && LoopWatchdog::readRecord(_watchdogRecord)) {
+        _watchdogRecordPending = true;
+        logWatchdogRecord();
+    }
+#endif
+
+    {
+        LOOP_STAGE(CoreApplication);
+        _coreApplication.task();
+    }
 
 #ifdef IOT_ENABLE_BLYNK
     if (!_settings.data.Scheduler.DisableBlynk) {
@@ -47,15 +94,112 @@ void Thermostat::task()
     }
 #endif
 
-    _ui.task();
-    _temperatureSensor.task();
+    _scheduler.task();
+    _powerManager.sleep(_scheduler.msUntilNextJob());
+}
+
+void Thermostat::updatePowerMode()
+{
+    const auto mode = _ui.isActive() ? PowerManager::Mode::Active : PowerManager::Mode::Idle;
+
+    if (_powerManager.setMode(mode)) {
+        _scheduler.setInterval(
+            _keypadJobId,
+            mode == PowerManager::Mode::Idle
+                ? PowerManager::IdleKeypadScanIntervalMs
+                : Keypad::ScanIntervalMs
+        );
+    }
+}
 
-    // Slow loop
-    if (_lastSlowLoopUpdate == 0 || millis() - _lastSlowLoopUpdate >= SlowLoopUpdateIntervalMs) {
-        _lastSlowLoopUpdate = millis();
+void Thermostat::slowLoopTask()
+{
+    {
+        const auto& clock = _coreApplication.systemClock();
+        const auto utc = clock.utcTime();
+        TraceRecorder::updateTime(utc, static_cast<int16_t>((clock.localTime() - utc) / 60));
+    }
+
+    {
+        LOOP_STAGE(HeatingController);
         _heatingController.task();
+    }
+
+    {
+        LOOP_STAGE(UiUpdate);
         _ui.update();
     }
+
+    updateTemperatureHistory();
+
+    if (_appConfig.mqtt.enabled) {
+        sampleTelemetry();
+    }
+}
+
+void Thermostat::updateTemperatureHistory()
+{
+    // Samples are aligned to the interval, so the blocks can be continued
+    // regardless of the slow loop's jitter
+    const auto slot = _coreApplication.systemClock().utcTime() / TemperatureHistory::SampleIntervalSecs;
+
+    if (slot == _lastHistorySlot) {
+        return;
+    }
+
+    _lastHistorySlot = slot;
+
+    _temperatureHistory.append(
+        slot * TemperatureHistory::SampleIntervalSecs,
+        _heatingController.currentTemp(),
+        _heatingController.targetTemp(),
+        _heatingController.isActive()
+    );
+}
+
+void Thermostat::sampleTelemetry()
+{
+    // Samples are only buffered while the broker is unreachable
+    if (_coreApplication.mqttClient().isConnected()) {
+        return;
+    }
+
+    const auto now = _coreApplication.systemClock().utcTime();
+    const auto slot = now / TelemetryOutbox::SampleIntervalSecs;
+
+    if (slot == _lastTelemetrySlot) {
+        return;
+    }
+
+    _lastTelemetrySlot = slot;
+
+    TelemetryOutbox::Entry entry;
+    entry.timestamp = now;
+    entry.currentTemp = _heatingController.currentTemp();
+    entry.targetTemp = _heatingController.targetTemp();
+    entry.heatingActive = _heatingController.isActive();
+    entry.boostActive = _heatingController.isBoostActive();
+
+    _telemetryOutbox.push(entry);
+}
+
+void Thermostat::drainTelemetryOutbox()
+{
+    if (_telemetryOutbox.isEmpty()) {
+        return;
+    }
+
+    auto& client = _coreApplication.mqttClient();
+
+    if (!client.isConnected()) {
+        return;
+    }
+
+    _telemetryOutbox.drain([&client](const char* payload, const std::size_t length) {
+        // A failed batch is kept and sent again
+        const auto published = client.publish(PSTR("thermostat/backfill"), std::string(payload, length), false);
+        return published && client.isConnected();
+    });
 }
 
 #ifdef IOT_ENABLE_BLYNK
@@ -78,156 +222,262 @@ void Thermostat::updateBlynk()
 void Thermostat::setupMqtt()
 {
     _mqtt.activeTemp.setChangedHandler([this](const float v) {
-        _heatingController.setTargetTemp(v * 10);
+        handleRemoteCommand({ RemoteCommand::Type::ActiveTemp, static_cast<int16_t>(v * 10) });
     });
 
     _mqtt.boostActive.setChangedHandler([this](const bool v) {
-        if (v) {
-            if (!_heatingController.isBoostActive()) {
-                _heatingController.activateBoost();
-            } else {
-                _heatingController.extendBoost();
-            }
-        } else {
-            _heatingController.deactivateBoost();
-        }
+        handleRemoteCommand({ RemoteCommand::Type::BoostActive, v });
     });
 
     _mqtt.daytimeTemp.setChangedHandler([this](const float v) {
-        _heatingController.setDaytimeTemp(v * 10);
+        handleRemoteCommand({ RemoteCommand::Type::DaytimeTemp, static_cast<int16_t>(v * 10) });
     });
 
     _mqtt.heatingMode.setChangedHandler([this](const int v) {
-        if (
-            v < static_cast<int>(HeatingController::Mode::_First)
-            || v > static_cast<int>(HeatingController::Mode::_Last)
-        ) {
-            return;
-        }
-
-        _heatingController.setMode(static_cast<HeatingController::Mode>(v));
+        handleRemoteCommand({ RemoteCommand::Type::HeatingMode, static_cast<int16_t>(v) });
     });
 
     _mqtt.nightTimeTemp.setChangedHandler([this](const float v) {
-        _heatingController.setNightTimeTemp(v * 10);
+        handleRemoteCommand({ RemoteCommand::Type::NightTimeTemp, static_cast<int16_t>(v * 10) });
     });
 
     //
-    // HVAC accessory for Home Assistant
+    // Home Assistant discovery (HVAC accessory, boost controls)
     //
 
-    {
-        std::stringstream config;
-
-        config << '{';
-        config << Extras::pgmToStdString(PSTR(R"("icon":"mdi:sun-thermometer")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"name":"Thermostat")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"object_id":"thermostat")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"unique_id":"thermostat")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"max_temp":30)"));
-        config << Extras::pgmToStdString(PSTR(R"(,"min_temp":10)"));
-        config << Extras::pgmToStdString(PSTR(R"(,"current_temperature_topic":"thermostat/temp/current")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"mode_command_topic":"thermostat/hvac_mode/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"mode_state_topic":"thermostat/hvac_mode")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"modes":["auto","heat","off"])"));
-        config << Extras::pgmToStdString(PSTR(R"(,"precision":0.1)"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_command_topic":"thermostat/temp/active/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_state_topic":"thermostat/temp/active")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_high_command_topic":"thermostat/temp/daytime/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_high_state_topic":"thermostat/temp/daytime")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_low_command_topic":"thermostat/temp/nightTime/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_low_state_topic":"thermostat/temp/nightTime")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temperature_unit":"C")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"temp_step":0.5)"));
-        config << '}';
+    MqttDiscovery::publishAll(_coreApplication.mqttClient());
 
-        _coreApplication.mqttClient().publish(
-            PSTR("homeassistant/climate/thermostat/config"),
-            config.str(),
-            false
-        );
-    }
+    _mqttAccessory.hvacMode.setChangedHandler([this](const std::string& mode) {
+        RemoteCommand::HvacMode hvacMode;
 
-    {
-        std::stringstream config;
+        if (mode == "off") {
+            hvacMode = RemoteCommand::HvacMode::Off;
+        } else if (mode == "heat") {
+            hvacMode = RemoteCommand::HvacMode::Heat;
+        } else if (mode == "auto") {
+            hvacMode = RemoteCommand::HvacMode::Auto;
+        } else {
+            return;
+        }
 
-        config << '{';
-        config << Extras::pgmToStdString(PSTR(R"("icon":"mdi:radiator")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"name":"Activate Boost")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"object_id":"thermostat_boost_activate")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"unique_id":"thermostat_boost_activate")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"command_topic":"thermostat/boost/active/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"payload_press":"1")"));
-        config << '}';
+        handleRemoteCommand({ RemoteCommand::Type::HvacMode, static_cast<int16_t>(hvacMode) });
+    });
 
-        _coreApplication.mqttClient().publish(
-            PSTR("homeassistant/button/thermostat_boost_activate/config"),
-            config.str(),
-            false
-        );
-    }
+#ifdef THERMOSTAT_ENABLE_PROFILER
+    _mqttAccessory.profilerDump.setChangedHandler([this](const bool dump) {
+        if (dump) {
+            dumpProfiler();
+        }
+    });
+#endif
 
-    {
-        std::stringstream config;
+#ifdef THERMOSTAT_ENABLE_TRACE
+    _mqttAccessory.traceDump.setChangedHandler([this](const bool dump) {
+        if (dump) {
+            dumpTrace();
+        }
+    });
+#endif
+}
 
-        config << '{';
-        config << Extras::pgmToStdString(PSTR(R"("icon":"mdi:radiator-off")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"name":"Deactivate Boost")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"object_id":"thermostat_boost_deactivate")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"unique_id":"thermostat_boost_deactivate")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"command_topic":"thermostat/boost/active/set")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"payload_press":"0")"));
-        config << '}';
+void Thermostat::handleRemoteCommand(const RemoteCommand& command)
+{
+    TraceRecorder::recordRemoteCommand(command);
+    command.apply(_heatingController);
+}
 
-        _coreApplication.mqttClient().publish(
-            PSTR("homeassistant/button/thermostat_boost_deactivate/config"),
-            config.str(),
-            false
-        );
-    }
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+void Thermostat::logWatchdogRecord()
+{
+    char stage[20] = { 0 };
+    strncpy_P(stage, loopStageName(static_cast<LoopStage>(_watchdogRecord.stage)), sizeof(stage) - 1);
+
+    char outerStage[20] = { 0 };
+    strncpy_P(outerStage, loopStageName(static_cast<LoopStage>(_watchdogRecord.outerStage)), sizeof(outerStage) - 1);
+
+    _log.warning_P(PSTR("loop stall: stage=%s, outerStage=%s, stageElapsed=%ums, loopElapsed=%ums, uptime=%ums, count=%u"),
+        stage,
+        outerStage,
+        _watchdogRecord.stageElapsedMs,
+        _watchdogRecord.loopElapsedMs,
+        _watchdogRecord.uptimeMs,
+        _watchdogRecord.stallCount
+    );
+}
 
-    {
-        std::stringstream config;
+void Thermostat::publishWatchdogRecord()
+{
+    char stage[20] = { 0 };
+    strncpy_P(stage, loopStageName(static_cast<LoopStage>(_watchdogRecord.stage)), sizeof(stage) - 1);
+
+    char outerStage[20] = { 0 };
+    strncpy_P(outerStage, loopStageName(static_cast<LoopStage>(_watchdogRecord.outerStage)), sizeof(outerStage) - 1);
+
+    char json[192] = { 0 };
+    snprintf_P(json, sizeof(json),
+        PSTR(R"({"stage":"%s","outerStage":"%s","stageElapsedMs":%u,"loopElapsedMs":%u,"uptimeMs":%u,"count":%u,"resetReason":"%s"})"),
+        stage,
+        outerStage,
+        _watchdogRecord.stageElapsedMs,
+        _watchdogRecord.loopElapsedMs,
+        _watchdogRecord.uptimeMs,
+        _watchdogRecord.stallCount,
+        ESP.getResetReason().c_str()
+    );
+
+    _coreApplication.mqttClient().publish(PSTR("thermostat/watchdog"), json, true);
+
+    LoopWatchdog::clearRecord();
+    _watchdogRecordPending = false;
+}
+#endif
 
-        config << '{';
-        config << Extras::pgmToStdString(PSTR(R"("icon":"mdi:timer")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"name":"Boost Remaining")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"object_id":"thermostat_boost_remaining")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"unique_id":"thermostat_boost_remaining")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"state_topic":"thermostat/boost/remainingSecs")"));
-        config << Extras::pgmToStdString(PSTR(R"(,"unit_of_measurement":"s")"));
-        config << '}';
+#ifdef THERMOSTAT_ENABLE_PROFILER
+void Thermostat::dumpProfiler()
+{
+    _log.info_P(PSTR("loop profiler statistics:"));
+    LoopProfiler::dump(_log);
 
-        _coreApplication.mqttClient().publish(
-            PSTR("homeassistant/sensor/thermostat_boost_remaining/config"),
-            config.str(),
-            false
-        );
-    }
+    std::string json(1024, 0);
+    json.resize(LoopProfiler::toJson(&json[0], json.size()));
 
-    _mqttAccessory.hvacMode.setChangedHandler([this](const std::string& mode) {
-        if (mode == "off") {
-            _heatingController.setMode(HeatingController::Mode::Off);
-        } else if (mode == "heat") {
-            if (!_heatingController.isBoostActive()) {
-                _heatingController.activateBoost();
-            }
-        } else if (mode == "auto") {
-            _heatingController.setMode(HeatingController::Mode::Normal);
+    _coreApplication.mqttClient().publish(PSTR("thermostat/profiler"), json, false);
+
+    LoopProfiler::reset();
+    _mqttAccessory.profilerDump = false;
+}
+#endif
+
+#ifdef THERMOSTAT_ENABLE_TRACE
+void Thermostat::dumpTrace()
+{
+    Trace::Header header;
+    header.droppedRecords = TraceRecorder::droppedRecords();
+    header.settings = _settings.data;
+
+    // The dump is the header followed by the records, split into chunks
+    const auto totalSize = sizeof(header) + TraceRecorder::size();
+    const auto chunkCount = (totalSize + TraceChunkSize - 1) / TraceChunkSize;
+
+    _log.info_P(PSTR("dumping trace: size=%u, chunks=%u, dropped=%u"),
+        totalSize,
+        chunkCount,
+        header.droppedRecords
+    );
+
+    auto& client = _coreApplication.mqttClient();
+    uint8_t chunk[TraceChunkSize];
+
+    for (std::size_t i = 0; i < chunkCount; ++i) {
+        const auto offset = i * TraceChunkSize;
+        std::size_t length = 0;
+
+        if (offset < sizeof(header)) {
+            length = std::min(sizeof(header) - offset, TraceChunkSize);
+            memcpy(chunk, reinterpret_cast<const uint8_t*>(&header) + offset, length);
         }
-    });
+
+        length += TraceRecorder::read(offset + length - sizeof(header), chunk + length, TraceChunkSize - length);
+
+        char prefix[48];
+        snprintf_P(prefix, sizeof(prefix), PSTR(R"({"seq":%u,"count":%u,"data":")"), i, chunkCount);
+
+        std::string json{ prefix };
+        Extras::base64Encode(chunk, length, json);
+        json += "\"}";
+
+        // The trace is kept until the whole dump was sent, then it's retried on reconnection
+        if (!client.publish(PSTR("thermostat/trace"), json, false) || !client.isConnected()) {
+            _log.warning_P(PSTR("trace dump interrupted: chunk=%u"), i);
+            _traceDumpPending = true;
+            return;
+        }
+    }
+
+    _traceDumpPending = false;
+    TraceRecorder::clear();
+    _mqttAccessory.traceDump = false;
+}
+#endif
+
+template <typename T>
+void Thermostat::updateMqttVariable(
+    MqttVariable<T>& variable,
+    MqttPublishPolicy& policy,
+    const T value,
+    const uint32_t timestamp
+)
+{
+    if (policy.shouldPublish(static_cast<float>(value), timestamp)) {
+        variable = value;
+    }
 }
 
 void Thermostat::updateMqtt()
 {
-    _mqtt.activeTemp = _heatingController.targetTemp() / 10.f;
-    _mqtt.boostActive = _heatingController.isBoostActive();
-    _mqtt.boostRemainingSecs = _heatingController.boostRemaining();
-    _mqtt.currentTemp = _heatingController.currentTemp() / 10.f;
-    _mqtt.daytimeTemp = _heatingController.daytimeTemp() / 10.f;
-    _mqtt.heatingActive = _heatingController.isActive();
-    _mqtt.heatingMode = static_cast<int>(_heatingController.mode());
-    _mqtt.nightTimeTemp = _heatingController.nightTimeTemp() / 10.f;
+    const auto connected = _coreApplication.mqttClient().isConnected();
+
+    if (connected && !_mqttConnected) {
+        _log.debug_P(PSTR("MQTT connected, forcing state update, suppressed updates: currentTemp=%u, boostRemainingSecs=%u"),
+            _mqttPolicies.currentTemp.suppressedCount(),
+            _mqttPolicies.boostRemainingSecs.suppressedCount()
+        );
+
+        if (!_telemetryOutbox.isEmpty()) {
+            _log.info_P(PSTR("backfilling telemetry: samples=%u, dropped=%u"),
+                _telemetryOutbox.size(),
+                _telemetryOutbox.overflowCount()
+            );
+        }
+
+        _mqttPolicies.activeTemp.forcePublish();
+        _mqttPolicies.currentTemp.forcePublish();
+        _mqttPolicies.daytimeTemp.forcePublish();
+        _mqttPolicies.nightTimeTemp.forcePublish();
+        _mqttPolicies.boostRemainingSecs.forcePublish();
+        _mqttPolicies.boostActive.forcePublish();
+        _mqttPolicies.heatingActive.forcePublish();
+        _mqttPolicies.heatingMode.forcePublish();
+
+#ifdef THERMOSTAT_MQTT_JSON_STATE
+        _mqttStateDocument.invalidate();
+#endif
+    }
+
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+    if (connected && _watchdogRecordPending) {
+        publishWatchdogRecord();
+    }
+#endif
+
+#ifdef THERMOSTAT_ENABLE_TRACE
+    if (connected && !_mqttConnected && _traceDumpPending) {
+        dumpTrace();
+    }
+#endif
+
+    _mqttConnected = connected;
+
+#ifdef THERMOSTAT_MQTT_JSON_STATE
+    updateMqttStateDocument();
+#endif
+
+#ifndef THERMOSTAT_MQTT_JSON_STATE_ONLY
+    // The policies only record the values that were sent, the ones changed
+    // while disconnected are forced out after reconnecting
+    if (connected) {
+        const auto now = millis();
+
+        updateMqttVariable(_mqtt.activeTemp, _mqttPolicies.activeTemp, _heatingController.targetTemp() / 10.f, now);
+        updateMqttVariable(_mqtt.boostActive, _mqttPolicies.boostActive, _heatingController.isBoostActive(), now);
+        updateMqttVariable(_mqtt.boostRemainingSecs, _mqttPolicies.boostRemainingSecs, static_cast<int>(_heatingController.boostRemaining()), now);
+        updateMqttVariable(_mqtt.currentTemp, _mqttPolicies.currentTemp, _heatingController.currentTemp() / 10.f, now);
+        updateMqttVariable(_mqtt.daytimeTemp, _mqttPolicies.daytimeTemp, _heatingController.daytimeTemp() / 10.f, now);
+        updateMqttVariable(_mqtt.heatingActive, _mqttPolicies.heatingActive, _heatingController.isActive(), now);
+        updateMqttVariable(_mqtt.heatingMode, _mqttPolicies.heatingMode, static_cast<int>(_heatingController.mode()), now);
+        updateMqttVariable(_mqtt.nightTimeTemp, _mqttPolicies.nightTimeTemp, _heatingController.nightTimeTemp() / 10.f, now);
+    }
+#endif
 
     _mqttAccessory.hvacMode = [this] {
         switch (_heatingController.mode()) {
@@ -241,4 +491,34 @@ void Thermostat::updateMqtt()
                 return "off";
         }
     }();
-}
\ No newline at end of file
+}
+
+#ifdef THERMOSTAT_MQTT_JSON_STATE
+void Thermostat::updateMqttStateDocument()
+{
+    MqttStateDocument::State state;
+
+    state.currentTemp = _heatingController.currentTemp();
+    state.activeTemp = _heatingController.targetTemp();
+    state.daytimeTemp = _heatingController.daytimeTemp();
+    state.nightTimeTemp = _heatingController.nightTimeTemp();
+    state.mode = static_cast<uint8_t>(_heatingController.mode());
+    state.boostActive = _heatingController.isBoostActive();
+    state.boostRemainingMins = (_heatingController.boostRemaining() + 59) / 60;
+    state.heatingActive = _heatingController.isActive();
+
+    const auto nt = _heatingController.nextTransition();
+    state.nextTransitionState = static_cast<uint8_t>(nt.state);
+    state.nextTransitionWeekday = nt.weekday;
+    state.nextTransitionHour = nt.hour;
+    state.nextTransitionMinute = nt.minute;
+
+    if (_mqttStateDocument.update(state)) {
+        _coreApplication.mqttClient().publish(
+            PSTR("thermostat/state"),
+            std::string(_mqttStateDocument.json(), _mqttStateDocument.length()),
+            false
+        );
+    }
+}
+#endif
\ No newline at end of file
@@ -3,7 +3,15 @@
 #include "Blynk.h"
 #include "HeatingController.h"
 #include "Keypad.h"
+#include "LoopStage.h"
+#include "MqttPublishPolicy.h"
+#include "MqttStateDocument.h"
+#include "PowerManager.h"
+#include "RemoteCommand.h"
 #include "Settings.h"
+#include "TaskScheduler.h"
+#include "TelemetryOutbox.h"
+#include "TemperatureHistory.h"
 #include "TemperatureSensor.h"
 #include "network/BlynkHandler.h"
 #include "ui/Ui.h"
@@ -12,6 +20,11 @@
 #include <Logger.h>
 #include <network/MQTT/MqttVariable.h>
 
+// Publishing only the state document implies publishing it
+#if defined(THERMOSTAT_MQTT_JSON_STATE_ONLY) && !defined(THERMOSTAT_MQTT_JSON_STATE)
+#define THERMOSTAT_MQTT_JSON_STATE
+#endif
+
 class Thermostat
 {
 public:
@@ -27,6 +40,7 @@ private:
     TemperatureSensor _temperatureSensor;
     HeatingController _heatingController;
     Keypad _keypad;
+    TemperatureHistory _temperatureHistory;
     Ui _ui;
 
 #ifdef IOT_ENABLE_BLYNK
@@ -34,8 +48,17 @@ private:
     void updateBlynk();
 #endif
 
+    TaskScheduler _scheduler;
+    TaskScheduler::JobId _keypadJobId = TaskScheduler::InvalidJobId;
+
+    PowerManager _powerManager;
+    void updatePowerMode();
+
     static constexpr auto SlowLoopUpdateIntervalMs = 500;
-    uint32_t _lastSlowLoopUpdate = 0;
+    void slowLoopTask();
+
+    std::time_t _lastHistorySlot = 0;
+    void updateTemperatureHistory();
 
     struct Mqtt {
         explicit Mqtt(CoreApplication& app)
@@ -59,15 +82,78 @@ private:
         MqttVariable<int> heatingMode;
     } _mqtt;
 
+    struct MqttPublishPolicies {
+        MqttPublishPolicy activeTemp;
+        // Single 0.1 C steps are mostly sensor noise, hold them back for a while
+        MqttPublishPolicy currentTemp{ { 0.15f, 10000, 300000 } };
+        MqttPublishPolicy daytimeTemp;
+        MqttPublishPolicy nightTimeTemp;
+        MqttPublishPolicy boostRemainingSecs{ { 0, 30000, 0 } };
+        MqttPublishPolicy boostActive;
+        MqttPublishPolicy heatingActive;
+        MqttPublishPolicy heatingMode;
+    } _mqttPolicies;
+
+    bool _mqttConnected = false;
+
+    TelemetryOutbox _telemetryOutbox;
+    std::time_t _lastTelemetrySlot = 0;
+    void sampleTelemetry();
+    void drainTelemetryOutbox();
+
+#ifdef THERMOSTAT_MQTT_JSON_STATE
+    MqttStateDocument _mqttStateDocument;
+    void updateMqttStateDocument();
+#endif
+
     struct MqttAccessory {
         explicit MqttAccessory(CoreApplication& app)
             : hvacMode(PSTR("thermostat/hvac_mode"), PSTR("thermostat/hvac_mode/set"), app.mqttClient())
-
+#ifdef THERMOSTAT_ENABLE_PROFILER
+            , profilerDump(PSTR("thermostat/profiler/dump"), PSTR("thermostat/profiler/dump/set"), app.mqttClient())
+#endif
+#ifdef THERMOSTAT_ENABLE_TRACE
+            , traceDump(PSTR("thermostat/trace/dump"), PSTR("thermostat/trace/dump/set"), app.mqttClient())
+#endif
         {}
 
         MqttVariable<std::string> hvacMode;
+#ifdef THERMOSTAT_ENABLE_PROFILER
+        MqttVariable<bool> profilerDump;
+#endif
+#ifdef THERMOSTAT_ENABLE_TRACE
+        MqttVariable<bool> traceDump;
+#endif
     } _mqttAccessory;
 
+    void handleRemoteCommand(const RemoteCommand& command);
+
+#ifdef THERMOSTAT_ENABLE_PROFILER
+    void dumpProfiler();
+#endif
+
+#ifdef THERMOSTAT_ENABLE_TRACE
+    // Raw bytes per published chunk, Base64 encoded in the payload
+    static constexpr std::size_t TraceChunkSize = 384;
+    bool _traceDumpPending = false;
+    void dumpTrace();
+#endif
+
+#ifdef THERMOSTAT_ENABLE_LOOP_WATCHDOG
+    LoopWatchdog::Record _watchdogRecord{};
+    bool _watchdogRecordPending = false;
+    void logWatchdogRecord();
+    void publishWatchdogRecord();
+#endif
+
     void setupMqtt();
     void updateMqtt();
+
+    template <typename T>
+    static void updateMqttVariable(
+        MqttVariable<T>& variable,
+        MqttPublishPolicy& policy,
+        T value,
+        uint32_t timestamp
+    );
 };
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Trace.h"
+
+std::size_t Trace::payloadSize(const RecordType type)
+{
+    switch (type) {
+        case RecordType::Time:
+            return 6;
+
+        case RecordType::SensorReading:
+        case RecordType::RemoteCommand:
+            return 2;
+
+        case RecordType::KeyEvent:
+            return 1;
+
+        case RecordType::Relay:
+        case RecordType::_Count:
+            break;
+    }
+
+    return 0;
+}
+
+std::size_t Trace::encode(const Record& record, uint8_t* const out)
+{
+    std::size_t size = 0;
+
+    out[size++] = (static_cast<uint8_t>(record.type) << 4) | (record.code & 0x0f);
+
+    auto delta = record.deltaMs;
+    do {
+        out[size++] = (delta & 0x7f) | (delta > 0x7f ? 0x80 : 0);
+        delta >>= 7;
+    } while (delta != 0);
+
+    const auto value = static_cast<uint32_t>(record.value);
+
+    switch (payloadSize(record.type)) {
+        case 6:
+            out[size++] = value & 0xff;
+            out[size++] = (value >> 8) & 0xff;
+            out[size++] = (value >> 16) & 0xff;
+            out[size++] = (value >> 24) & 0xff;
+            out[size++] = static_cast<uint16_t>(record.utcOffsetMins) & 0xff;
+            out[size++] = static_cast<uint16_t>(record.utcOffsetMins) >> 8;
+            break;
+
+        case 2:
+            out[size++] = value & 0xff;
+            out[size++] = (value >> 8) & 0xff;
+            break;
+
+        case 1:
+            out[size++] = value & 0xff;
+            break;
+    }
+
+    return size;
+}
+
+Trace::Reader::Reader(const uint8_t* const data, const std::size_t size)
+    : _data(data)
+    , _size(size)
+{}
+
+bool Trace::Reader::next(Record& record)
+{
+    auto offset = _offset;
+
+    if (offset >= _size) {
+        return false;
+    }
+
+    const auto header = _data[offset++];
+    if ((header >> 4) >= static_cast<uint8_t>(RecordType::_Count)) {
+        return false;
+    }
+
+    record = {};
+    record.type = static_cast<RecordType>(header >> 4);
+    record.code = header & 0x0f;
+
+    for (uint8_t shift = 0; ; shift += 7) {
+        if (offset >= _size || shift > 28) {
+            return false;
+        }
+
+        const auto b = _data[offset++];
+        record.deltaMs |= static_cast<uint32_t>(b & 0x7f) << shift;
+
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+
+    const auto payload = payloadSize(record.type);
+    if (offset + payload > _size) {
+        return false;
+    }
+
+    const auto p = _data + offset;
+
+    switch (payload) {
+        case 6:
+            record.value = static_cast<int32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24));
+            record.utcOffsetMins = static_cast<int16_t>(p[4] | (p[5] << 8));
+            break;
+
+        case 2:
+            record.value = static_cast<int16_t>(p[0] | (p[1] << 8));
+            break;
+
+        case 1:
+            record.value = p[0];
+            break;
+    }
+
+    _offset = offset + payload;
+
+    return true;
+}
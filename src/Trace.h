@@ -0,0 +1,105 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Binary format of the field traces (see TraceRecorder).
+//
+// Records start with a byte holding the type in the upper and a type
+// specific code in the lower nibble, followed by the time since the
+// previous record in milliseconds as a LEB128 varint, then the payload:
+//
+//  Time            code: 0             UTC (u32), UTC offset minutes (i16)
+//  SensorReading   code: 0             1/100 Celsius (i16)
+//  KeyEvent        code: event type    keys (u8)
+//  RemoteCommand   code: command type  value (i16)
+//  Relay           code: state         -
+//
+// Multi-byte values are little endian. A dump consists of a Header and
+// the records, oldest first.
+
+#include "Settings.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Trace
+{
+    enum class RecordType : uint8_t
+    {
+        Time,
+        SensorReading,
+        KeyEvent,
+        RemoteCommand,
+        Relay,
+
+        _Count
+    };
+
+    struct Record
+    {
+        RecordType type = RecordType::Time;
+        uint8_t code = 0;
+        uint32_t deltaMs = 0;
+
+        // Time: UTC, SensorReading: 1/100 Celsius,
+        // KeyEvent: keys, RemoteCommand: value
+        int32_t value = 0;
+
+        // Time only
+        int16_t utcOffsetMins = 0;
+    };
+
+    static constexpr std::size_t MaxRecordSize = 1 + 5 + 6;
+
+    struct __attribute__((packed)) Header
+    {
+        static constexpr uint32_t MagicValue = 0x31435254; // "TRC1"
+
+        uint32_t magic = MagicValue;
+        uint16_t headerSize = sizeof(Header);
+
+        // Records dropped from the ring since the last clear
+        uint32_t droppedRecords = 0;
+
+        // Settings at the time of the dump
+        Settings::Data settings;
+    };
+
+    std::size_t payloadSize(RecordType type);
+
+    // Returns the encoded size, out must hold MaxRecordSize bytes
+    std::size_t encode(const Record& record, uint8_t* out);
+
+    class Reader
+    {
+    public:
+        Reader(const uint8_t* data, std::size_t size);
+
+        // Returns false at the end or on a truncated record
+        bool next(Record& record);
+
+    private:
+        const uint8_t* const _data;
+        const std::size_t _size;
+        std::size_t _offset = 0;
+    };
+}
@@ -0,0 +1,206 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#ifdef THERMOSTAT_ENABLE_TRACE
+
+#include "Trace.h"
+#include "TraceRecorder.h"
+
+#include "hal/Time.h"
+
+#include <algorithm>
+
+namespace
+{
+    uint8_t Buffer[TraceRecorder::BufferSize];
+    std::size_t Head = 0;
+    std::size_t Size = 0;
+    uint32_t DroppedRecords = 0;
+
+    uint32_t LastRecordMillis = 0;
+    bool Empty = true;
+
+    std::time_t LastTimeUtc = 0;
+    uint32_t LastTimeMillis = 0;
+    bool TimeRecorded = false;
+
+    int16_t LastSensorReading = 0;
+    bool SensorReadingValid = false;
+
+    bool RelayActive = false;
+
+    uint8_t byteAt(const std::size_t offset)
+    {
+        return Buffer[(Head + offset) % TraceRecorder::BufferSize];
+    }
+
+    std::size_t oldestRecordSize()
+    {
+        std::size_t size = 1;
+
+        while (size < Size && (byteAt(size) & 0x80)) {
+            ++size;
+        }
+
+        // Last byte of the delta
+        ++size;
+
+        return size + Trace::payloadSize(static_cast<Trace::RecordType>(byteAt(0) >> 4));
+    }
+
+    void append(Trace::Record record)
+    {
+        const auto now = Hal::Time::millis();
+        record.deltaMs = Empty ? 0 : now - LastRecordMillis;
+        LastRecordMillis = now;
+        Empty = false;
+
+        uint8_t encoded[Trace::MaxRecordSize];
+        const auto length = Trace::encode(record, encoded);
+
+        while (TraceRecorder::BufferSize - Size < length) {
+            const auto dropped = std::min(oldestRecordSize(), Size);
+            Head = (Head + dropped) % TraceRecorder::BufferSize;
+            Size -= dropped;
+            ++DroppedRecords;
+        }
+
+        for (std::size_t i = 0; i < length; ++i) {
+            Buffer[(Head + Size + i) % TraceRecorder::BufferSize] = encoded[i];
+        }
+
+        Size += length;
+    }
+}
+
+void TraceRecorder::recordSensorReading(const int16_t hundredths)
+{
+    if (SensorReadingValid && hundredths == LastSensorReading) {
+        return;
+    }
+
+    LastSensorReading = hundredths;
+    SensorReadingValid = true;
+
+    Trace::Record record;
+    record.type = Trace::RecordType::SensorReading;
+    record.value = hundredths;
+
+    append(record);
+}
+
+void TraceRecorder::recordKeyEvent(const Keypad::KeyEvent& event)
+{
+    Trace::Record record;
+    record.type = Trace::RecordType::KeyEvent;
+    record.code = static_cast<uint8_t>(event.type);
+    record.value = static_cast<uint8_t>(event.key);
+
+    append(record);
+}
+
+void TraceRecorder::recordRemoteCommand(const RemoteCommand& command)
+{
+    Trace::Record record;
+    record.type = Trace::RecordType::RemoteCommand;
+    record.code = static_cast<uint8_t>(command.type);
+    record.value = command.value;
+
+    append(record);
+}
+
+void TraceRecorder::recordRelay(const bool active)
+{
+    RelayActive = active;
+
+    Trace::Record record;
+    record.type = Trace::RecordType::Relay;
+    record.code = active ? 1 : 0;
+
+    append(record);
+}
+
+void TraceRecorder::updateTime(const std::time_t utc, const int16_t utcOffsetMins)
+{
+    const auto now = Hal::Time::millis();
+
+    if (TimeRecorded) {
+        const auto expectedUtc = LastTimeUtc + static_cast<std::time_t>((now - LastTimeMillis) / 1000);
+        const auto drift = utc > expectedUtc ? utc - expectedUtc : expectedUtc - utc;
+
+        if (drift <= ClockJumpThresholdSecs && utc - LastTimeUtc < TimeRecordIntervalSecs) {
+            return;
+        }
+    }
+
+    LastTimeUtc = utc;
+    LastTimeMillis = now;
+    TimeRecorded = true;
+
+    Trace::Record record;
+    record.type = Trace::RecordType::Time;
+    record.value = static_cast<int32_t>(utc);
+    record.utcOffsetMins = utcOffsetMins;
+
+    append(record);
+
+    // Repeat the state after each Time record, in case
+    // the previous records get dropped from the ring
+    recordRelay(RelayActive);
+    SensorReadingValid = false;
+}
+
+std::size_t TraceRecorder::size()
+{
+    return Size;
+}
+
+std::size_t TraceRecorder::read(const std::size_t offset, uint8_t* const buffer, const std::size_t length)
+{
+    if (offset >= Size) {
+        return 0;
+    }
+
+    const auto count = std::min(length, Size - offset);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        buffer[i] = byteAt(offset + i);
+    }
+
+    return count;
+}
+
+uint32_t TraceRecorder::droppedRecords()
+{
+    return DroppedRecords;
+}
+
+void TraceRecorder::clear()
+{
+    Head = 0;
+    Size = 0;
+    DroppedRecords = 0;
+    Empty = true;
+    TimeRecorded = false;
+    SensorReadingValid = false;
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Records the inputs of the thermostat and the relay transitions into a RAM
+// ring buffer (see Trace.h for the format), so a field trace can be dumped
+// over MQTT and replayed on the host.
+// Compiled out unless THERMOSTAT_ENABLE_TRACE is defined.
+
+#include "Keypad.h"
+#include "RemoteCommand.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+#ifndef THERMOSTAT_TRACE_BUFFER_SIZE
+// Roughly a day of typical use
+#define THERMOSTAT_TRACE_BUFFER_SIZE 4096
+#endif
+
+#ifdef THERMOSTAT_ENABLE_TRACE
+
+class TraceRecorder
+{
+public:
+    static constexpr std::size_t BufferSize = THERMOSTAT_TRACE_BUFFER_SIZE;
+
+    // Time records are repeated periodically, so the trace can be
+    // decoded after the oldest records were dropped
+    static constexpr uint32_t TimeRecordIntervalSecs = 600;
+
+    // Clock adjustments larger than this get their own Time record
+    static constexpr uint32_t ClockJumpThresholdSecs = 2;
+
+    static_assert(BufferSize >= 64, "Trace buffer is too small");
+
+    // Unchanged readings are not recorded
+    static void recordSensorReading(int16_t hundredths);
+    static void recordKeyEvent(const Keypad::KeyEvent& event);
+    static void recordRemoteCommand(const RemoteCommand& command);
+    static void recordRelay(bool active);
+
+    // Should be called periodically with the current system time
+    static void updateTime(std::time_t utc, int16_t utcOffsetMins);
+
+    // Size of the recorded data
+    static std::size_t size();
+
+    // Copies the recorded data starting at the given offset, oldest first.
+    // Returns the number of bytes copied.
+    static std::size_t read(std::size_t offset, uint8_t* buffer, std::size_t length);
+
+    static uint32_t droppedRecords();
+
+    static void clear();
+};
+
+#else
+
+class TraceRecorder
+{
+public:
+    static void recordSensorReading(int16_t) {}
+    static void recordKeyEvent(const Keypad::KeyEvent&) {}
+    static void recordRemoteCommand(const RemoteCommand&) {}
+    static void recordRelay(bool) {}
+    static void updateTime(std::time_t, int16_t) {}
+};
+
+#endif
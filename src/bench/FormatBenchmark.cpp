@@ -0,0 +1,171 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "FormatBenchmark.h"
+
+#include "Format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    // Keeps the timed calls from being optimized out
+    volatile uint32_t Sink;
+
+    struct Case
+    {
+        const char* name;
+        int32_t first;
+        int32_t last;
+        std::size_t (*format)(char* buf, int32_t value);
+        int (*print)(char* buf, std::size_t size, int32_t value);
+    };
+
+    const Case Cases[] = {
+        {
+            "tenths", -400, 400,
+            [](char* buf, const int32_t v) { return Format::tenths(buf, static_cast<int16_t>(v)); },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%s%d.%d", v < 0 ? "-" : "", abs(v) / 10, abs(v) % 10);
+            }
+        },
+        {
+            "tenths_float", -400, 400,
+            [](char* buf, const int32_t v) {
+                // Rounded like Blynk::floatToStr()
+                const auto f = v / 10.0f;
+                return Format::tenths(buf, static_cast<int16_t>(f * 10 + (f < 0 ? -0.5f : 0.5f)));
+            },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%0.1f", v / 10.0f);
+            }
+        },
+        {
+            "tenths_padded", 0, 400,
+            [](char* buf, const int32_t v) { return Format::tenths(buf, static_cast<int16_t>(v), 4); },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%2d.%d", v / 10, v % 10);
+            }
+        },
+        {
+            "hours_minutes", 0, 24 * 60 - 1,
+            [](char* buf, const int32_t v) {
+                return Format::hoursMinutes(buf, static_cast<uint8_t>(v / 60), static_cast<uint8_t>(v % 60));
+            },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%02d:%02d", v / 60, v % 60);
+            }
+        },
+        {
+            "minutes_seconds", 0, 1000 * 60 - 1,
+            [](char* buf, const int32_t v) {
+                return Format::minutesSeconds(buf, static_cast<uint16_t>(v / 60), static_cast<uint8_t>(v % 60));
+            },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%3u:%02u", static_cast<unsigned>(v / 60), static_cast<unsigned>(v % 60));
+            }
+        },
+        {
+            "integer_padded", -999, 9999,
+            [](char* buf, const int32_t v) { return Format::integer(buf, v, 3); },
+            [](char* buf, const std::size_t size, const int32_t v) {
+                return snprintf(buf, size, "%3d", static_cast<int>(v));
+            }
+        },
+    };
+
+    template <typename Function>
+    double measure(const Case& c, const uint32_t iterations, Function&& format)
+    {
+        char buf[Format::IntegerBufferSize];
+        uint32_t calls = 0;
+        uint32_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < iterations; ++i) {
+            for (auto v = c.first; v <= c.last; ++v) {
+                sink += format(buf, v);
+                ++calls;
+            }
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        Sink = sink;
+
+        return std::chrono::duration<double, std::nano>(elapsed).count() / calls;
+    }
+}
+
+bool FormatBenchmark::run(const uint32_t iterations)
+{
+    bool ok = true;
+
+    printf("%-16s %10s %10s %8s\n", "case", "printf ns", "format ns", "speedup");
+
+    for (const auto& c : Cases) {
+        char expected[Format::IntegerBufferSize];
+        char actual[Format::IntegerBufferSize];
+
+        for (auto v = c.first; v <= c.last; ++v) {
+            const auto expectedLength = c.print(expected, sizeof(expected), v);
+            const auto actualLength = c.format(actual, v);
+
+            if (static_cast<std::size_t>(expectedLength) != actualLength || strcmp(expected, actual) != 0) {
+                printf("%-16s mismatch at %d: \"%s\" != \"%s\"\n", c.name, static_cast<int>(v), actual, expected);
+                ok = false;
+                break;
+            }
+        }
+
+        const auto printNanos = measure(c, iterations, [&c](char* buf, const int32_t v) {
+            return static_cast<std::size_t>(c.print(buf, Format::IntegerBufferSize, v));
+        });
+
+        const auto formatNanos = measure(c, iterations, c.format);
+
+        printf("%-16s %10.1f %10.1f %7.1fx\n", c.name, printNanos, formatNanos, printNanos / formatNanos);
+    }
+
+    return ok;
+}
+
+int FormatBenchmark::main(const int argc, char* argv[])
+{
+    uint32_t iterations = 10;
+
+    for (auto i = 1; i < argc; ++i) {
+        const auto separator = strchr(argv[i], '=');
+
+        if (!separator || strncmp(argv[i], "iterations", separator - argv[i]) != 0) {
+            fprintf(stderr, "invalid argument: %s, expected iterations=N\n", argv[i]);
+            return 2;
+        }
+
+        iterations = std::max(1ul, strtoul(separator + 1, nullptr, 10));
+    }
+
+    return run(iterations) ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Compares the Format functions with the snprintf calls they replace: the
+// outputs must match, and both are timed on the host.
+
+#include <cstdint>
+
+namespace FormatBenchmark
+{
+    // Returns false if any output differs from snprintf
+    bool run(uint32_t iterations);
+
+    // Host program entry, parameters are given as key=value arguments:
+    //  iterations=N    passes over the values of each case
+    int main(int argc, char* argv[]);
+}
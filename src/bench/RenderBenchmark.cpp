@@ -0,0 +1,292 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "RenderBenchmark.h"
+
+#include "HeatingController.h"
+#include "Settings.h"
+#include "TemperatureSensor.h"
+
+#include "display/Display.h"
+#include "display/Text.h"
+#include "hal/native/Native.h"
+#include "hal/native/VirtualOled.h"
+#include "native/MemorySettingsHandler.h"
+#include "native/NativeClock.h"
+#include "ui/DrawHelper.h"
+#include "ui/Graphics.h"
+#include "ui/MainScreen.h"
+#include "ui/MenuScreen.h"
+#include "ui/SchedulingScreen.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+namespace
+{
+    // Monday, 2026-10-19 13:37:00 UTC
+    constexpr std::time_t StartTime = 1792368000 + 13 * 3600 + 37 * 60;
+
+    constexpr auto I2cClockHz = 400000;
+
+    // Bits per byte with the acknowledge, plus START and STOP per transaction
+    constexpr auto BitsPerByte = 9;
+    constexpr auto BitsPerTransaction = 2;
+
+    struct Case
+    {
+        const char* name;
+        std::function<void()> draw;
+    };
+
+    Settings::SchedulerDayData ScheduleDay = { 0x00, 0xf0, 0xff, 0x0f, 0xf0, 0x0f };
+
+    // Draws like the Ui does, sending only the changed bytes
+    template <typename Draw>
+    void drawFrame(Draw&& draw)
+    {
+        Display::beginFrame();
+        draw();
+        Display::endFrame();
+    }
+}
+
+double RenderBenchmark::Result::busMicros() const
+{
+    return (busBytes * BitsPerByte + transactions * BitsPerTransaction) * 1e6 / I2cClockHz;
+}
+
+std::vector<RenderBenchmark::Result> RenderBenchmark::run(const uint32_t iterations)
+{
+    Hal::Native::reset();
+
+    VirtualOled oled;
+    Hal::I2c::attach(&oled);
+
+    MemorySettingsHandler settingsHandler;
+    Settings settings{ settingsHandler };
+    NativeClock clock{ StartTime };
+    TemperatureSensor temperatureSensor{ settings };
+    HeatingController heatingController{ settings, clock, temperatureSensor };
+
+    MainScreen mainScreen{ settings, clock, heatingController, temperatureSensor };
+    MenuScreen menuScreen{ settings };
+    SchedulingScreen schedulingScreen{ settings, clock };
+
+    Display::init();
+
+    const Case cases[] = {
+        { "text_short", [] { Text::draw("21.5", 0, 0, 0, false); } },
+        { "text_long", [] { Text::draw("Heating 21.5 C 12:34", 0, 0, 0, false); } },
+        { "text_proportional", [] { Text::drawProportional("Heating 21.5 C 12:34", 0, 0, 0, false); } },
+        { "text_7seg", [] { Text::draw7Seg("21", 2, 10); } },
+        { "schedule_bar", [] { draw_schedule_bar(ScheduleDay); } },
+        { "temperature_value", [] { draw_temperature_value(10, 21, 5); } },
+        { "multipage_bitmap", [] { graphics_draw_multipage_bitmap(graphics_flame_icon_20x3p, 92, 2); } },
+        { "display_fill", [] { Display::fill(0); } },
+        { "main_screen", [&mainScreen] { Display::clear(); mainScreen.activate(); } },
+        { "main_screen_update", [&mainScreen] { mainScreen.update(); } },
+        { "menu_screen", [&menuScreen] { Display::clear(); menuScreen.activate(); } },
+        { "scheduling_screen", [&schedulingScreen] { Display::clear(); schedulingScreen.activate(); } },
+        { "main_update_frame", [&mainScreen] { drawFrame([&mainScreen] { mainScreen.update(); }); } },
+        { "screen_transition", [&mainScreen, &menuScreen, toMenu = false]() mutable {
+            Screen& screen = toMenu ? static_cast<Screen&>(menuScreen) : mainScreen;
+            toMenu = !toMenu;
+            drawFrame([&screen] { Display::clear(); screen.activate(); });
+        } },
+        { "menu_page_change", [&menuScreen, forward = false]() mutable {
+            forward = !forward;
+            menuScreen.keyPress(forward ? Keypad::Keys::Right : Keypad::Keys::Left);
+        } },
+    };
+
+    std::vector<Result> results;
+
+    for (const auto& c : cases) {
+        // Warm up, so state kept by the screens doesn't skew the first call
+        c.draw();
+
+        oled.beginFrame();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < iterations; ++i) {
+            c.draw();
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto traffic = oled.endFrame();
+
+        Result r;
+        r.name = c.name;
+        r.transactions = static_cast<double>(traffic.starts) / iterations;
+        r.busBytes = static_cast<double>(traffic.busBytes()) / iterations;
+        r.dataBytes = static_cast<double>(traffic.dataBytes) / iterations;
+        r.hostNanos = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+
+        results.push_back(r);
+    }
+
+    return results;
+}
+
+bool RenderBenchmark::saveBaseline(const char* const path, const std::vector<Result>& results)
+{
+    const auto file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file, "# name transactions busBytes dataBytes hostNanos\n");
+
+    for (const auto& r : results) {
+        fprintf(file, "%s %.2f %.2f %.2f %.0f\n", r.name.c_str(), r.transactions, r.busBytes, r.dataBytes, r.hostNanos);
+    }
+
+    return fclose(file) == 0;
+}
+
+bool RenderBenchmark::loadBaseline(const char* const path, std::vector<Result>& results)
+{
+    const auto file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    char line[160];
+
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#') {
+            continue;
+        }
+
+        char name[64];
+        Result r;
+
+        if (sscanf(line, "%63s %lf %lf %lf %lf", name, &r.transactions, &r.busBytes, &r.dataBytes, &r.hostNanos) == 5) {
+            r.name = name;
+            results.push_back(r);
+        }
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+bool RenderBenchmark::report(const std::vector<Result>& results, const std::vector<Result>* const baseline)
+{
+    const auto change = [](const double value, const double base) {
+        return base > 0 ? (value - base) * 100 / base : 0;
+    };
+
+    bool ok = true;
+
+    printf("%-20s %8s %9s %9s %10s %10s\n", "case", "xfers", "bytes", "data", "bus us", "host ns");
+
+    for (const auto& r : results) {
+        printf("%-20s %8.1f %9.1f %9.1f %10.1f %10.0f\n",
+            r.name.c_str(), r.transactions, r.busBytes, r.dataBytes, r.busMicros(), r.hostNanos);
+
+        if (!baseline) {
+            continue;
+        }
+
+        const Result* base = nullptr;
+        for (const auto& b : *baseline) {
+            if (b.name == r.name) {
+                base = &b;
+                break;
+            }
+        }
+
+        if (!base) {
+            printf("%-20s not in the baseline\n", "");
+            continue;
+        }
+
+        // The traffic is deterministic, the host time is only indicative
+        const auto regressed = r.transactions > base->transactions + 0.005 || r.busBytes > base->busBytes + 0.005;
+        ok = ok && !regressed;
+
+        printf("%-20s %+7.1f%% %+8.1f%% %+8.1f%% %+9.1f%% %+9.1f%%%s\n", "",
+            change(r.transactions, base->transactions),
+            change(r.busBytes, base->busBytes),
+            change(r.dataBytes, base->dataBytes),
+            change(r.busMicros(), base->busMicros()),
+            change(r.hostNanos, base->hostNanos),
+            regressed ? "  REGRESSION" : ""
+        );
+    }
+
+    return ok;
+}
+
+int RenderBenchmark::main(const int argc, char* argv[])
+{
+    uint32_t iterations = 1000;
+    const char* baselinePath = nullptr;
+    const char* savePath = nullptr;
+
+    for (auto i = 1; i < argc; ++i) {
+        const auto separator = strchr(argv[i], '=');
+
+        if (!separator) {
+            fprintf(stderr, "invalid argument: %s, expected key=value\n", argv[i]);
+            return 2;
+        }
+
+        *separator = '\0';
+        const auto value = separator + 1;
+
+        if (strcmp(argv[i], "iterations") == 0) {
+            iterations = std::max(1ul, strtoul(value, nullptr, 10));
+        } else if (strcmp(argv[i], "baseline") == 0) {
+            baselinePath = value;
+        } else if (strcmp(argv[i], "save") == 0) {
+            savePath = value;
+        } else {
+            fprintf(stderr, "unknown parameter: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    std::vector<Result> baseline;
+    if (baselinePath && !loadBaseline(baselinePath, baseline)) {
+        fprintf(stderr, "can't read baseline: %s\n", baselinePath);
+        return 2;
+    }
+
+    const auto results = run(iterations);
+    const auto ok = report(results, baselinePath ? &baseline : nullptr);
+
+    if (savePath && !saveBaseline(savePath, results)) {
+        fprintf(stderr, "can't write baseline: %s\n", savePath);
+        return 2;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Rendering micro-benchmarks on the emulated display. Each case is timed on
+// the host and its I2C traffic is counted by the virtual OLED, so display
+// changes can be judged by the bytes they put on the bus.
+//
+// The reference numbers are kept in render.baseline next to this file.
+// Update it along with display changes:
+//  program bench baseline=src/bench/render.baseline save=src/bench/render.baseline
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RenderBenchmark
+{
+    struct Result
+    {
+        std::string name;
+
+        // Averages per call
+        double transactions = 0;
+        double busBytes = 0;
+        double dataBytes = 0;
+        double hostNanos = 0;
+
+        // Time the traffic would take on the 400 kHz bus of the device
+        double busMicros() const;
+    };
+
+    std::vector<Result> run(uint32_t iterations);
+
+    bool saveBaseline(const char* path, const std::vector<Result>& results);
+    bool loadBaseline(const char* path, std::vector<Result>& results);
+
+    // Prints the results, with the changes against the baseline if given.
+    // Returns false if any case sends more traffic than in the baseline.
+    bool report(const std::vector<Result>& results, const std::vector<Result>* baseline);
+
+    // Host program entry, parameters are given as key=value arguments:
+    //  iterations=N    calls per case
+    //  baseline=PATH   compare against a baseline file
+    //  save=PATH       write the results as a new baseline
+    int main(int argc, char* argv[]);
+}
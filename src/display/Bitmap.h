@@ -0,0 +1,256 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Compile-time conversion of ASCII-art images into the page layout of the
+// display. Each byte is a column of 8 pixels with the top one in the least
+// significant bit, the pages follow each other from the top of the image.
+//
+// Rows are given top to bottom, '#' is a lit and '.' is a dark pixel:
+//
+//  constexpr auto Arrow = Bitmap::fromAscii(
+//      "..#..",
+//      ".###.",
+//      "#####"
+//  );
+//
+// Images can be compressed with PackBits, they are decoded while drawn.
+
+#include <pgmspace.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Bitmap
+{
+    enum class Encoding : uint8_t
+    {
+        Raw,
+        PackBits
+    };
+
+    template <std::size_t Width, std::size_t Pages>
+    struct Pixels
+    {
+        static constexpr auto width = Width;
+        static constexpr auto pages = Pages;
+        static constexpr auto size = Width * Pages;
+
+        uint8_t data[size];
+    };
+
+    template <std::size_t Width, std::size_t Pages, std::size_t Size>
+    struct PackedPixels
+    {
+        static constexpr auto width = Width;
+        static constexpr auto pages = Pages;
+        static constexpr auto size = Size;
+
+        uint8_t data[size];
+    };
+
+    // Type independent view of an image in flash
+    struct Image
+    {
+        const uint8_t* data;
+        uint8_t width;
+        uint8_t pages;
+        Encoding encoding;
+    };
+
+    namespace Detail
+    {
+        // Not constexpr, so reaching it fails the compile-time evaluation
+        inline void invalidPixelCharacter() {}
+
+        constexpr bool isLit(const char c)
+        {
+            if (c != '#' && c != '.') {
+                invalidPixelCharacter();
+            }
+
+            return c == '#';
+        }
+
+        // PackBits: a control byte N < 128 is followed by N + 1 literal
+        // bytes, N > 128 by a byte repeated 257 - N times.
+        // Returns the encoded size, out can be null to measure only.
+        constexpr std::size_t packBits(const uint8_t* const in, const std::size_t length, uint8_t* const out)
+        {
+            std::size_t size = 0;
+            std::size_t i = 0;
+
+            while (i < length) {
+                std::size_t run = 1;
+                while (i + run < length && run < 128 && in[i + run] == in[i]) {
+                    ++run;
+                }
+
+                if (run >= 2) {
+                    if (out) {
+                        out[size] = static_cast<uint8_t>(257 - run);
+                        out[size + 1] = in[i];
+                    }
+
+                    size += 2;
+                    i += run;
+                    continue;
+                }
+
+                // Literals last until the next run of at least 3
+                std::size_t literals = 1;
+                while (
+                    i + literals < length
+                    && literals < 128
+                    && !(i + literals + 2 < length
+                        && in[i + literals] == in[i + literals + 1]
+                        && in[i + literals] == in[i + literals + 2])
+                ) {
+                    ++literals;
+                }
+
+                if (out) {
+                    out[size] = static_cast<uint8_t>(literals - 1);
+
+                    for (std::size_t j = 0; j < literals; ++j) {
+                        out[size + 1 + j] = in[i + j];
+                    }
+                }
+
+                size += 1 + literals;
+                i += literals;
+            }
+
+            return size;
+        }
+    }
+
+    template <std::size_t Stride, typename... Rows>
+    constexpr auto fromAscii(const char (&firstRow)[Stride], const Rows&... rows)
+    {
+        static_assert(Stride > 1, "Image rows can't be empty");
+        static_assert((std::is_same<Rows, char[Stride]>::value && ...), "Image rows must have the same width");
+
+        constexpr auto Width = Stride - 1;
+        constexpr auto Height = 1 + sizeof...(Rows);
+
+        static_assert(Height <= 64, "Image is taller than the display");
+
+        Pixels<Width, (Height + 7) / 8> image{};
+        const char* const source[Height] = { firstRow, rows... };
+
+        for (std::size_t y = 0; y < Height; ++y) {
+            for (std::size_t x = 0; x < Width; ++x) {
+                if (Detail::isLit(source[y][x])) {
+                    image.data[(y / 8) * Width + x] |= 1 << (y % 8);
+                }
+            }
+        }
+
+        return image;
+    }
+
+    template <std::size_t Width, std::size_t Pages>
+    constexpr std::size_t packedSize(const Pixels<Width, Pages>& pixels)
+    {
+        return Detail::packBits(pixels.data, pixels.size, nullptr);
+    }
+
+    // Use with packedSize() as the size: Bitmap::pack<Bitmap::packedSize(Icon)>(Icon)
+    template <std::size_t Size, std::size_t Width, std::size_t Pages>
+    constexpr PackedPixels<Width, Pages, Size> pack(const Pixels<Width, Pages>& pixels)
+    {
+        PackedPixels<Width, Pages, Size> packed{};
+        Detail::packBits(pixels.data, pixels.size, packed.data);
+        return packed;
+    }
+
+    template <std::size_t Width, std::size_t Pages>
+    constexpr Image image(const Pixels<Width, Pages>& pixels)
+    {
+        static_assert(Width <= 255 && Pages <= 8, "Image doesn't fit on the display");
+        return { pixels.data, Width, Pages, Encoding::Raw };
+    }
+
+    template <std::size_t Width, std::size_t Pages, std::size_t Size>
+    constexpr Image image(const PackedPixels<Width, Pages, Size>& packed)
+    {
+        static_assert(Width <= 255 && Pages <= 8, "Image doesn't fit on the display");
+        return { packed.data, Width, Pages, Encoding::PackBits };
+    }
+
+    // Sequential reader of the image bytes in flash, decoding them if needed
+    class Reader
+    {
+    public:
+        explicit Reader(const Image& image)
+            : _data(image.data)
+            , _packed(image.encoding == Encoding::PackBits)
+        {}
+
+        void read(uint8_t* out, std::size_t length)
+        {
+            if (!_packed) {
+                memcpy_P(out, _data, length);
+                _data += length;
+                return;
+            }
+
+            while (length > 0) {
+                if (_remaining == 0) {
+                    const auto control = pgm_read_byte(_data++);
+
+                    if (control < 128) {
+                        _remaining = control + 1;
+                        _repeat = false;
+                    } else {
+                        _remaining = 257 - control;
+                        _repeat = true;
+                        _value = pgm_read_byte(_data++);
+                    }
+                }
+
+                const auto count = _remaining < length ? _remaining : length;
+
+                if (_repeat) {
+                    memset(out, _value, count);
+                } else {
+                    memcpy_P(out, _data, count);
+                    _data += count;
+                }
+
+                out += count;
+                length -= count;
+                _remaining -= count;
+            }
+        }
+
+    private:
+        const uint8_t* _data;
+        const bool _packed;
+        std::size_t _remaining = 0;
+        bool _repeat = false;
+        uint8_t _value = 0;
+    };
+}
@@ -20,10 +20,16 @@
 
 #pragma once
 
-#include "../config.h"
+#include "../Config.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
+// Keeps a copy of the shown image. Between beginFrame() and endFrame() the
+// drawing only goes to the back buffer, and endFrame() sends just the runs
+// of bytes that differ from what is shown. Outside of frames everything is
+// sent right away, like without the buffers.
 template <typename DriverImpl>
 class DisplayImpl
 {
@@ -34,6 +40,10 @@ public:
     static constexpr auto Height = Driver::Height;
     static constexpr auto Lines = Driver::Lines;
 
+    // Unchanged bytes between differing ones are sent up to this length,
+    // addressing a new run costs 7 bytes on the bus
+    static constexpr uint8_t MaxRunGap = 7;
+
     DisplayImpl() = delete;
 
     static void init()
@@ -51,7 +61,14 @@ public:
 
     static void fill(const uint8_t pattern)
     {
+        memset(_back, pattern, sizeof(_back));
+
+        if (isInFrame())
+            return;
+
         Driver::fill(pattern);
+        memset(_front, pattern, sizeof(_front));
+        _frontValid = true;
     }
 
     static void fillArea(
@@ -65,17 +82,18 @@ public:
         if (width == 0 || column >= Driver::Width)
             return;
 
+        const uint8_t length = std::min<uint8_t>(width, Driver::Width - column);
+
         for (uint8_t i = 0; i < height; ++i) {
             uint8_t line = startLine + i;
             if (line >= 8)
                 return;
 
-            Driver::setLine(line);
-            Driver::setColumn(column);
+            setLine(line);
+            setColumn(column);
 
-            for (uint8_t j = 0; j < width && column + j < Driver::Width; ++j) {
-                Driver::sendData(pattern);
-            }
+            memset(&_back[line][column], pattern, length);
+            sendBack(length);
         }
     }
 
@@ -96,12 +114,36 @@ public:
 
     static void sendData(uint8_t data, uint8_t bitShift = 0, bool invert = false)
     {
-        Driver::sendData(data, bitShift, invert);
+        sendData(&data, 1, bitShift, invert);
     }
 
     static void sendData(const uint8_t* data, uint8_t length, uint8_t bitShift = 0, bool invert = false)
     {
-        Driver::sendData(data, length, bitShift, invert);
+        if (_line >= Lines) {
+            Driver::sendData(data, length, bitShift, invert);
+            return;
+        }
+
+        if (_column >= Width)
+            return;
+
+        length = std::min<uint8_t>(length, Width - _column);
+
+        auto* const target = &_back[_line][_column];
+        for (uint8_t i = 0; i < length; ++i) {
+            uint8_t b = data[i] << bitShift;
+            if (invert)
+                b = ~b;
+
+            target[i] = b;
+        }
+
+        sendBack(length);
+    }
+
+    static uint8_t contrast()
+    {
+        return Driver::contrast();
     }
 
     static void setContrast(const uint8_t value)
@@ -111,12 +153,118 @@ public:
 
     static void setColumn(const uint8_t column)
     {
-        Driver::setColumn(column);
+        _column = column;
+
+        if (!isInFrame())
+            Driver::setColumn(column);
     }
 
     static void setLine(const uint8_t line)
     {
-        Driver::setLine(line);
+        _line = line;
+
+        if (!isInFrame())
+            Driver::setLine(line);
+    }
+
+    // Frames can be nested, only the outermost one is sent
+    static void beginFrame()
+    {
+        ++_frameDepth;
+    }
+
+    static void endFrame()
+    {
+        if (_frameDepth == 0 || --_frameDepth > 0)
+            return;
+
+        for (uint8_t line = 0; line < Lines; ++line) {
+            sendChangedRuns(line);
+        }
+
+        memcpy(_front, _back, sizeof(_front));
+        _frontValid = true;
+
+        if (_startLinePending) {
+            _startLinePending = false;
+            Driver::setDisplayStartLine(_startLine);
+        }
+    }
+
+    static bool isInFrame()
+    {
+        return _frameDepth > 0;
+    }
+
+    // Rotates the image vertically without touching the display RAM.
+    // In a frame it's applied after the frame was sent, so the old image
+    // isn't shown rotated while it's being replaced.
+    static void setStartLine(const uint8_t line)
+    {
+        if (isInFrame()) {
+            _startLine = line;
+            _startLinePending = true;
+            return;
+        }
+
+        Driver::setDisplayStartLine(line);
+    }
+
+private:
+    static inline uint8_t _front[Lines][Width] = {};
+    static inline uint8_t _back[Lines][Width] = {};
+    static inline bool _frontValid = false;
+    static inline uint8_t _frameDepth = 0;
+    static inline uint8_t _startLine = 0;
+    static inline bool _startLinePending = false;
+    static inline uint8_t _line = 0;
+    static inline uint8_t _column = 0;
+
+    // Sends the bytes just written to the back buffer at the cursor
+    static void sendBack(const uint8_t length)
+    {
+        if (isInFrame()) {
+            _column += length;
+            return;
+        }
+
+        const auto* const data = &_back[_line][_column];
+        Driver::sendData(data, length);
+        memcpy(&_front[_line][_column], data, length);
+        _column += length;
+    }
+
+    static void sendChangedRuns(const uint8_t line)
+    {
+        const auto* const back = _back[line];
+        auto* const front = _front[line];
+        bool lineAddressed = false;
+
+        uint8_t column = 0;
+        while (column < Width) {
+            if (_frontValid && back[column] == front[column]) {
+                ++column;
+                continue;
+            }
+
+            // Extend the run while the gaps of unchanged bytes are short
+            const uint8_t start = column;
+            uint8_t end = column + 1;
+            for (uint8_t next = end; next < Width && next - end <= MaxRunGap; ++next) {
+                if (!_frontValid || back[next] != front[next])
+                    end = next + 1;
+            }
+
+            if (!lineAddressed) {
+                Driver::setLine(line);
+                lineAddressed = true;
+            }
+
+            Driver::setColumn(start);
+            Driver::sendData(&back[start], end - start);
+
+            column = end;
+        }
     }
 };
 
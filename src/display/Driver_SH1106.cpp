@@ -19,12 +19,13 @@
 */
 
 #include "Driver_SH1106.h"
-#include "drivers/SimpleI2C.h"
+#include "hal/I2c.h"
 
 using namespace Driver;
-using namespace Drivers; // I2C
+using I2C = Hal::I2c;
 
 bool SH1106::_poweredOn = false;
+uint8_t SH1106::_contrast = 0;
 
 enum {
     SH1106_I2C_ADDRESS = 0x3Cu,
@@ -187,8 +188,14 @@ void SH1106::setComScanInverted(const bool inverted)
     sendCommand(SH1106_CMD_SET_COM_OUT_SCAN_DIR | (inverted ? 0x08u : 0u));
 }
 
+uint8_t SH1106::contrast()
+{
+    return _contrast;
+}
+
 void SH1106::setContrast(const uint8_t value)
 {
+    _contrast = value;
     sendCommand(SH1106_CMD_SET_CONTRAST_CONTROL, value);
 }
 
@@ -19,12 +19,13 @@
 */
 
 #include "Driver_SSD1306.h"
-#include "drivers/SimpleI2C.h"
+#include "hal/I2c.h"
 
 using namespace Driver;
-using namespace Drivers; // I2C
+using I2C = Hal::I2c;
 
 bool SSD1306::_poweredOn = false;
+uint8_t SSD1306::_contrast = 0;
 
 #define SSD1306_128_64
 
@@ -216,8 +217,14 @@ void SSD1306::setComScanInverted(const bool inverted)
     sendCommand(SSD1306_CMD_COMSCANINC | (inverted ? 0x08u : 0u));
 }
 
+uint8_t SSD1306::contrast()
+{
+    return _contrast;
+}
+
 void SSD1306::setContrast(const uint8_t value)
 {
+    _contrast = value;
     sendCommand(SSD1306_CMD_SETCONTRAST, value);
 }
 
@@ -53,6 +53,7 @@ public:
     static void setPowerOn(bool on);
     static void setComPadsAltHwConfig(uint8_t value);
     static void setComScanInverted(bool inverted);
+    static uint8_t contrast();
     static void setContrast(uint8_t value);
     static void setDcDcConvOn(bool on);
     static void setDischargePrechargePeriod(uint8_t precharge, uint8_t discharge);
@@ -71,6 +72,7 @@ public:
 
 private:
     static bool _poweredOn;
+    static uint8_t _contrast;
 };
 
 }
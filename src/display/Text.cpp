@@ -18,1356 +18,1614 @@
     Created on 2020-01-22
 */
 
+#include "Bitmap.h"
 #include "Display.h"
 #include "Text.h"
 
+#include <pgmspace.h>
+
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 
 constexpr auto DefaultCharWidth = 5;
 constexpr auto DefaultSpaceWidth = 1;
+constexpr auto DefaultFirstChar = ' ';
 
-static const uint8_t DefaultCharset[][DefaultCharWidth] = {
+static constexpr Bitmap::Pixels<DefaultCharWidth, 1> DefaultCharset[] PROGMEM = {
     // [space]
-    {
-        0, 0, 0, 0, 0
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // !
-    {
-        0b00000000,
-        0b00000000,
-        0b01001111,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        ".....",
+        ".....",
+        "..#..",
+        "....."
+    ),
     // "
-    {
-        0b00000000,
-        0b00000111,
-        0b00000000,
-        0b00000111,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".#.#.",
+        ".#.#.",
+        ".#.#.",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // #
-    {
-        0b00010100,
-        0b01111111,
-        0b00010100,
-        0b01111111,
-        0b00010100
-    },
+    Bitmap::fromAscii(
+        ".#.#.",
+        ".#.#.",
+        "#####",
+        ".#.#.",
+        "#####",
+        ".#.#.",
+        ".#.#.",
+        "....."
+    ),
     // $
-    {
-        0b00100100,
-        0b00101010,
-        0b01111111,
-        0b00101010,
-        0b00010010
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        ".####",
+        "#.#..",
+        ".###.",
+        "..#.#",
+        "####.",
+        "..#..",
+        "....."
+    ),
     // %
-    {
-        0b00100011,
-        0b00010011,
-        0b00001000,
-        0b01100100,
-        0b01100010
-    },
+    Bitmap::fromAscii(
+        "##...",
+        "##..#",
+        "...#.",
+        "..#..",
+        ".#...",
+        "#..##",
+        "...##",
+        "....."
+    ),
     // &
-    {
-        0b00110110,
-        0b01001001,
-        0b01010101,
-        0b00100010,
-        0b01010000
-    },
+    Bitmap::fromAscii(
+        ".##..",
+        "#..#.",
+        "#.#..",
+        ".#...",
+        "#.#.#",
+        "#..#.",
+        ".##.#",
+        "....."
+    ),
     // '
-    {
-        0b00000000,
-        0b00000101,
-        0b00000011,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".##..",
+        "..#..",
+        ".#...",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // (
-    {
-        0b00000000,
-        0b00011100,
-        0b00100010,
-        0b01000001,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "...#.",
+        "..#..",
+        ".#...",
+        ".#...",
+        ".#...",
+        "..#..",
+        "...#.",
+        "....."
+    ),
     // )
-    {
-        0b00000000,
-        0b01000001,
-        0b00100010,
-        0b00011100,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".#...",
+        "..#..",
+        "...#.",
+        "...#.",
+        "...#.",
+        "..#..",
+        ".#...",
+        "....."
+    ),
     // *
-    {
-        0b00010100,
-        0b00001000,
-        0b00111110,
-        0b00001000,
-        0b00010100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        "..#..",
+        "#.#.#",
+        ".###.",
+        "#.#.#",
+        "..#..",
+        ".....",
+        "....."
+    ),
     // +
-    {
-        0b00001000,
-        0b00001000,
-        0b00111110,
-        0b00001000,
-        0b00001000,
-    },
+    Bitmap::fromAscii(
+        ".....",
+        "..#..",
+        "..#..",
+        "#####",
+        "..#..",
+        "..#..",
+        ".....",
+        "....."
+    ),
     // ,
-    {
-        0b00000000,
-        0b01010000,
-        0b00110000,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".##..",
+        "..#..",
+        ".#...",
+        "....."
+    ),
     // -
-    {
-        0b00001000,
-        0b00001000,
-        0b00001000,
-        0b00001000,
-        0b00001000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".....",
+        "#####",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // .
-    {
-        0b00000000,
-        0b01100000,
-        0b01100000,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".##..",
+        ".##..",
+        "....."
+    ),
     // /
-    {
-        0b00100000,
-        0b00010000,
-        0b00001000,
-        0b00000100,
-        0b00000010
-    },
+    Bitmap::fromAscii(
+        ".....",
+        "....#",
+        "...#.",
+        "..#..",
+        ".#...",
+        "#....",
+        ".....",
+        "....."
+    ),
     // 0
-    {
-        0b00111110,
-        0b01010001,
-        0b01001001,
-        0b01000101,
-        0b00111110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#..##",
+        "#.#.#",
+        "##..#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // 1
-    {
-        0b00000000,
-        0b01000010,
-        0b01111111,
-        0b01000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        ".##..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        ".###.",
+        "....."
+    ),
     // 2
-    {
-        0b01000010,
-        0b01100001,
-        0b01010001,
-        0b01001001,
-        0b01000110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "....#",
+        "...#.",
+        "..#..",
+        ".#...",
+        "#####",
+        "....."
+    ),
     // 3
-    {
-        0b00100001,
-        0b01000001,
-        0b01000101,
-        0b01001011,
-        0b00110001
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "...#.",
+        "..#..",
+        "...#.",
+        "....#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // 4
-    {
-        0b00011000,
-        0b00010100,
-        0b00010010,
-        0b01111111,
-        0b00010000
-    },
+    Bitmap::fromAscii(
+        "...#.",
+        "..##.",
+        ".#.#.",
+        "#..#.",
+        "#####",
+        "...#.",
+        "...#.",
+        "....."
+    ),
     // 5
-    {
-        0b00100111,
-        0b01000101,
-        0b01000101,
-        0b01000101,
-        0b00111001
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "#....",
+        "####.",
+        "....#",
+        "....#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // 6
-    {
-        0b00111100,
-        0b01001010,
-        0b01001001,
-        0b01001001,
-        0b00110000
-    },
+    Bitmap::fromAscii(
+        "..##.",
+        ".#...",
+        "#....",
+        "####.",
+        "#...#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // 7
-    {
-        0b00000001,
-        0b01110001,
-        0b00001001,
-        0b00000101,
-        0b00000011
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "....#",
+        "...#.",
+        "..#..",
+        ".#...",
+        ".#...",
+        ".#...",
+        "....."
+    ),
     // 8
-    {
-        0b00110110,
-        0b01001001,
-        0b01001001,
-        0b01001001,
-        0b00110110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#...#",
+        ".###.",
+        "#...#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // 9
-    {
-        0b00000110,
-        0b01001001,
-        0b01001001,
-        0b00101001,
-        0b00011110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#...#",
+        ".####",
+        "....#",
+        "...#.",
+        ".##..",
+        "....."
+    ),
     // :
-    {
-        0b00000000,
-        0b00110110,
-        0b00110110,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".##..",
+        ".##..",
+        ".....",
+        ".##..",
+        ".##..",
+        ".....",
+        "....."
+    ),
     // ;
-    {
-        0b00000000,
-        0b01010110,
-        0b00110110,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".##..",
+        ".##..",
+        ".....",
+        ".##..",
+        "..#..",
+        ".#...",
+        "....."
+    ),
     // <
-    {
-        0b00001000,
-        0b00010100,
-        0b00100010,
-        0b01000001,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "...#.",
+        "..#..",
+        ".#...",
+        "#....",
+        ".#...",
+        "..#..",
+        "...#.",
+        "....."
+    ),
     // =
-    {
-        0b00010100,
-        0b00010100,
-        0b00010100,
-        0b00010100,
-        0b00010100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#####",
+        ".....",
+        "#####",
+        ".....",
+        ".....",
+        "....."
+    ),
     // >
-    {
-        0b00000000,
-        0b01000001,
-        0b00100010,
-        0b00010100,
-        0b00001000
-    },
+    Bitmap::fromAscii(
+        ".#...",
+        "..#..",
+        "...#.",
+        "....#",
+        "...#.",
+        "..#..",
+        ".#...",
+        "....."
+    ),
     // ?
-    {
-        0b00000010,
-        0b00000001,
-        0b01010001,
-        0b00001001,
-        0b00000110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "....#",
+        "...#.",
+        "..#..",
+        ".....",
+        "..#..",
+        "....."
+    ),
     // @
-    {
-        0b00110010,
-        0b01001001,
-        0b01111001,
-        0b01000001,
-        0b00111110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "....#",
+        ".##.#",
+        "#.#.#",
+        "#.#.#",
+        ".###.",
+        "....."
+    ),
     // A
-    {
-        0b01111110,
-        0b00010001,
-        0b00010001,
-        0b00010001,
-        0b01111110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#####",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // B
-    {
-        0b01111111,
-        0b01001001,
-        0b01001001,
-        0b01001001,
-        0b00110110
-    },
+    Bitmap::fromAscii(
+        "####.",
+        "#...#",
+        "#...#",
+        "####.",
+        "#...#",
+        "#...#",
+        "####.",
+        "....."
+    ),
     // C
-    {
-        0b00111110,
-        0b01000001,
-        0b01000001,
-        0b01000001,
-        0b00100010
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#....",
+        "#....",
+        "#....",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // D
-    {
-        0b01111111,
-        0b01000001,
-        0b01000001,
-        0b00100010,
-        0b00011100
-    },
+    Bitmap::fromAscii(
+        "###..",
+        "#..#.",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#..#.",
+        "###..",
+        "....."
+    ),
     // E
-    {
-        0b01111111,
-        0b01001001,
-        0b01001001,
-        0b01001001,
-        0b01000001
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "#....",
+        "#....",
+        "####.",
+        "#....",
+        "#....",
+        "#####",
+        "....."
+    ),
     // F
-    {
-        0b01111111,
-        0b00001001,
-        0b00001001,
-        0b00001001,
-        0b00000001
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "#....",
+        "#....",
+        "####.",
+        "#....",
+        "#....",
+        "#....",
+        "....."
+    ),
     // G
-    {
-        0b00111110,
-        0b01000001,
-        0b01001001,
-        0b01001001,
-        0b01111010
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#....",
+        "#.###",
+        "#...#",
+        "#...#",
+        ".####",
+        "....."
+    ),
     // H
-    {
-        0b01111111,
-        0b00001000,
-        0b00001000,
-        0b00001000,
-        0b01111111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "#...#",
+        "#####",
+        "#...#",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // I
-    {
-        0b00000000,
-        0b01000001,
-        0b01111111,
-        0b01000001,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        ".###.",
+        "....."
+    ),
     // J
-    {
-        0b00100000,
-        0b01000000,
-        0b01000001,
-        0b00111111,
-        0b00000001
-    },
+    Bitmap::fromAscii(
+        "..###",
+        "...#.",
+        "...#.",
+        "...#.",
+        "...#.",
+        "#..#.",
+        ".##..",
+        "....."
+    ),
     // K
-    {
-        0b01111111,
-        0b00001000,
-        0b00010100,
-        0b00100010,
-        0b01000001
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#..#.",
+        "#.#..",
+        "##...",
+        "#.#..",
+        "#..#.",
+        "#...#",
+        "....."
+    ),
     // L
-    {
-        0b01111111,
-        0b01000000,
-        0b01000000,
-        0b01000000,
-        0b01000000
-    },
+    Bitmap::fromAscii(
+        "#....",
+        "#....",
+        "#....",
+        "#....",
+        "#....",
+        "#....",
+        "#####",
+        "....."
+    ),
     // M
-    {
-        0b01111111,
-        0b00000010,
-        0b00001100,
-        0b00000010,
-        0b01111111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "##.##",
+        "#.#.#",
+        "#.#.#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // N
-    {
-        0b01111111,
-        0b00000100,
-        0b00001000,
-        0b00010000,
-        0b01111111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "##..#",
+        "#.#.#",
+        "#..##",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // O
-    {
-        0b00111110,
-        0b01000001,
-        0b01000001,
-        0b01000001,
-        0b00111110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // P
-    {
-        0b01111111,
-        0b00001001,
-        0b00001001,
-        0b00001001,
-        0b00000110
-    },
+    Bitmap::fromAscii(
+        "####.",
+        "#...#",
+        "#...#",
+        "####.",
+        "#....",
+        "#....",
+        "#....",
+        "....."
+    ),
     // Q
-    {
-        0b00111110,
-        0b01000001,
-        0b01010001,
-        0b00100001,
-        0b01011110
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#.#.#",
+        "#..#.",
+        ".##.#",
+        "....."
+    ),
     // R
-    {
-        0b01111111,
-        0b00001001,
-        0b00011001,
-        0b00101001,
-        0b01000110
-    },
+    Bitmap::fromAscii(
+        "####.",
+        "#...#",
+        "#...#",
+        "####.",
+        "#.#..",
+        "#..#.",
+        "#...#",
+        "....."
+    ),
     // S
-    {
-        0b01000110,
-        0b01001001,
-        0b01001001,
-        0b01001001,
-        0b00110001
-    },
+    Bitmap::fromAscii(
+        ".####",
+        "#....",
+        "#....",
+        ".###.",
+        "....#",
+        "....#",
+        "####.",
+        "....."
+    ),
     // T
-    {
-        0b00000001,
-        0b00000001,
-        0b01111111,
-        0b00000001,
-        0b00000001
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "....."
+    ),
     // U
-    {
-        0b00111111,
-        0b01000000,
-        0b01000000,
-        0b01000000,
-        0b00111111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // V
-    {
-        0b00011111,
-        0b00100000,
-        0b01000000,
-        0b00100000,
-        0b00011111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#...#",
+        ".#.#.",
+        "..#..",
+        "....."
+    ),
     // W
-    {
-        0b00111111,
-        0b01000000,
-        0b00111000,
-        0b01000000,
-        0b00111111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "#...#",
+        "#.#.#",
+        "#.#.#",
+        "#.#.#",
+        ".#.#.",
+        "....."
+    ),
     // X
-    {
-        0b01100011,
-        0b00010100,
-        0b00001000,
-        0b00010100,
-        0b01100011
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        ".#.#.",
+        "..#..",
+        ".#.#.",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // Y
-    {
-        0b00000111,
-        0b00001000,
-        0b01110000,
-        0b00001000,
-        0b00000111
-    },
+    Bitmap::fromAscii(
+        "#...#",
+        "#...#",
+        "#...#",
+        ".#.#.",
+        "..#..",
+        "..#..",
+        "..#..",
+        "....."
+    ),
     // Z
-    {
-        0b01100001,
-        0b01010001,
-        0b01001001,
-        0b01000101,
-        0b01000011
-    },
+    Bitmap::fromAscii(
+        "#####",
+        "....#",
+        "...#.",
+        "..#..",
+        ".#...",
+        "#....",
+        "#####",
+        "....."
+    ),
     // [
-    {
-        0b00000000,
-        0b01111111,
-        0b01000001,
-        0b01000001,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        ".#...",
+        ".#...",
+        ".#...",
+        ".#...",
+        ".#...",
+        ".###.",
+        "....."
+    ),
     // backslash
-    {
-        0b00000010,
-        0b00000100,
-        0b00001000,
-        0b00010000,
-        0b00100000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        "#....",
+        ".#...",
+        "..#..",
+        "...#.",
+        "....#",
+        ".....",
+        "....."
+    ),
     // ]
-    {
-        0b00000000,
-        0b01000001,
-        0b01000001,
-        0b01111111,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".###.",
+        "...#.",
+        "...#.",
+        "...#.",
+        "...#.",
+        "...#.",
+        ".###.",
+        "....."
+    ),
     // ^
-    {
-        0b00000100,
-        0b00000010,
-        0b00000001,
-        0b00000010,
-        0b00000100
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        ".#.#.",
+        "#...#",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // _
-    {
-        0b01000000,
-        0b01000000,
-        0b01000000,
-        0b01000000,
-        0b01000000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "#####",
+        "....."
+    ),
     // `
-    {
-        0b00000000,
-        0b00000001,
-        0b00000010,
-        0b00000100,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".#...",
+        "..#..",
+        "...#.",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "....."
+    ),
     // a
-    {
-        0b00100000,
-        0b01010100,
-        0b01010100,
-        0b01010100,
-        0b01111000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".###.",
+        "....#",
+        ".####",
+        "#...#",
+        ".####",
+        "....."
+    ),
     // b
-    {
-        0b01111111,
-        0b01001000,
-        0b01000100,
-        0b01000100,
-        0b00111000
-    },
+    Bitmap::fromAscii(
+        "#....",
+        "#....",
+        "#.##.",
+        "##..#",
+        "#...#",
+        "#...#",
+        "####.",
+        "....."
+    ),
     // c
-    {
-        0b00111000,
-        0b01000100,
-        0b01000100,
-        0b01000100,
-        0b00100000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".###.",
+        "#....",
+        "#....",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // d
-    {
-        0b00111000,
-        0b01000100,
-        0b01000100,
-        0b01001000,
-        0b01111111
-    },
+    Bitmap::fromAscii(
+        "....#",
+        "....#",
+        ".##.#",
+        "#..##",
+        "#...#",
+        "#...#",
+        ".####",
+        "....."
+    ),
     // e
-    {
-        0b00111000,
-        0b01010100,
-        0b01010100,
-        0b01010100,
-        0b00011000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".###.",
+        "#...#",
+        "#####",
+        "#....",
+        ".###.",
+        "....."
+    ),
     // f
-    {
-        0b00001000,
-        0b01111110,
-        0b00001001,
-        0b00000001,
-        0b00000010
-    },
+    Bitmap::fromAscii(
+        "..##.",
+        ".#..#",
+        ".#...",
+        "###..",
+        ".#...",
+        ".#...",
+        ".#...",
+        "....."
+    ),
     // g
-    {
-        0b00001100,
-        0b01010010,
-        0b01010010,
-        0b01010010,
-        0b00111110
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".####",
+        "#...#",
+        "#...#",
+        ".####",
+        "....#",
+        ".###.",
+        "....."
+    ),
     // h
-    {
-        0b01111111,
-        0b00001000,
-        0b00000100,
-        0b00000100,
-        0b01111000
-    },
+    Bitmap::fromAscii(
+        "#....",
+        "#....",
+        "#.##.",
+        "##..#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // i
-    {
-        0b00000000,
-        0b01000100,
-        0b01111101,
-        0b01000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        ".....",
+        ".##..",
+        "..#..",
+        "..#..",
+        "..#..",
+        ".###.",
+        "....."
+    ),
     // j
-    {
-        0b00100000,
-        0b01000000,
-        0b01000000,
-        0b00111101,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "...#.",
+        ".....",
+        "...#.",
+        "...#.",
+        "...#.",
+        "#..#.",
+        ".##..",
+        "....."
+    ),
     // k
-    {
-        0b01111111,
-        0b00010000,
-        0b00101000,
-        0b01000100,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "#....",
+        "#....",
+        "#..#.",
+        "#.#..",
+        "##...",
+        "#.#..",
+        "#..#.",
+        "....."
+    ),
     // l
-    {
-        0b00000000,
-        0b01000001,
-        0b01111111,
-        0b01000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".##..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        ".###.",
+        "....."
+    ),
     // m
-    {
-        0b01111100,
-        0b00000100,
-        0b00011000,
-        0b00000100,
-        0b01111000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "##.#.",
+        "#.#.#",
+        "#.#.#",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // n
-    {
-        0b01111100,
-        0b00001000,
-        0b00000100,
-        0b00000100,
-        0b01111000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#.##.",
+        "##..#",
+        "#...#",
+        "#...#",
+        "#...#",
+        "....."
+    ),
     // o
-    {
-        0b00111000,
-        0b01000100,
-        0b01000100,
-        0b01000100,
-        0b00111000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".###.",
+        "#...#",
+        "#...#",
+        "#...#",
+        ".###.",
+        "....."
+    ),
     // p
-    {
-        0b01111100,
-        0b00010100,
-        0b00010100,
-        0b00010100,
-        0b00001000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "####.",
+        "#...#",
+        "####.",
+        "#....",
+        "#....",
+        "....."
+    ),
     // q
-    {
-        0b00001000,
-        0b00010100,
-        0b00010100,
-        0b00011000,
-        0b01111100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".##.#",
+        "#..##",
+        ".####",
+        "....#",
+        "....#",
+        "....."
+    ),
     // r
-    {
-        0b01111100,
-        0b00001000,
-        0b00000100,
-        0b00000100,
-        0b00001000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#.##.",
+        "##..#",
+        "#....",
+        "#....",
+        "#....",
+        "....."
+    ),
     // s
-    {
-        0b01001000,
-        0b01010100,
-        0b01010100,
-        0b01010100,
-        0b00100000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".###.",
+        "#....",
+        ".###.",
+        "....#",
+        "####.",
+        "....."
+    ),
     // t
-    {
-        0b00000100,
-        0b00111111,
-        0b01000100,
-        0b01000000,
-        0b00100000
-    },
+    Bitmap::fromAscii(
+        ".#...",
+        ".#...",
+        "###..",
+        ".#...",
+        ".#...",
+        ".#..#",
+        "..##.",
+        "....."
+    ),
     // u
-    {
-        0b00111100,
-        0b01000000,
-        0b01000000,
-        0b00100000,
-        0b01111100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#...#",
+        "#...#",
+        "#...#",
+        "#..##",
+        ".##.#",
+        "....."
+    ),
     // v
-    {
-        0b00011100,
-        0b00100000,
-        0b01000000,
-        0b00100000,
-        0b00011100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#...#",
+        "#...#",
+        "#...#",
+        ".#.#.",
+        "..#..",
+        "....."
+    ),
     // w
-    {
-        0b00111100,
-        0b01000000,
-        0b00110000,
-        0b01000000,
-        0b00111100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#...#",
+        "#...#",
+        "#.#.#",
+        "#.#.#",
+        ".#.#.",
+        "....."
+    ),
     // x
-    {
-        0b01000100,
-        0b00101000,
-        0b00010000,
-        0b00101000,
-        0b01000100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#...#",
+        ".#.#.",
+        "..#..",
+        ".#.#.",
+        "#...#",
+        "....."
+    ),
     // y
-    {
-        0b00001100,
-        0b01010000,
-        0b01010000,
-        0b01010000,
-        0b00111100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#...#",
+        "#...#",
+        ".####",
+        "....#",
+        ".###.",
+        "....."
+    ),
     // z
-    {
-        0b01000100,
-        0b01100100,
-        0b01010100,
-        0b01001100,
-        0b01000100
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        "#####",
+        "...#.",
+        "..#..",
+        ".#...",
+        "#####",
+        "....."
+    ),
     // {
-    {
-        0b00000000,
-        0b00001000,
-        0b00110110,
-        0b01000001,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "...#.",
+        "..#..",
+        "..#..",
+        ".#...",
+        "..#..",
+        "..#..",
+        "...#.",
+        "....."
+    ),
     // |
-    {
-        0b00000000,
-        0b00000000,
-        0b01111111,
-        0b00000000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "..#..",
+        "....."
+    ),
     // }
-    {
-        0b00000000,
-        0b01000001,
-        0b00110110,
-        0b00001000,
-        0b00000000
-    },
+    Bitmap::fromAscii(
+        ".#...",
+        "..#..",
+        "..#..",
+        "...#.",
+        "..#..",
+        "..#..",
+        ".#...",
+        "....."
+    ),
     // ~
-    {
-        0b00001000,
-        0b00000100,
-        0b00001000,
-        0b00010000,
-        0b00001000
-    },
+    Bitmap::fromAscii(
+        ".....",
+        ".....",
+        ".#...",
+        "#.#.#",
+        "...#.",
+        ".....",
+        ".....",
+        "....."
+    ),
 };
 
-static const uint8_t DefaultCharPlaceholder[DefaultCharWidth] = {
-    0b01111111,
-    0b01010101,
-    0b01001001,
-    0b01010101,
-    0b01111111
-};
+static constexpr auto DefaultCharPlaceholder PROGMEM = Bitmap::fromAscii(
+    "#####",
+    "#...#",
+    "##.##",
+    "#.#.#",
+    "##.##",
+    "#...#",
+    "#####",
+    "....."
+);
 
 #define SevenSegCharWidth 12
 #define SevenSegCharLines 3
-static const uint8_t SevenSegCharset[11][SevenSegCharLines][SevenSegCharWidth] = {
-    {
-        // 0, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 0, Page 1
-        {
-            0b11111111,
-            0b11110111,
-            0b11100011,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100011,
-            0b11110111,
-            0b11111111
-        },
-        // 0, Page 2
-        {
-            0b00111111,
-            0b01011111,
-            0b01101111,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
-        }
-    },
-    {
-        // 1, Page 0
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111000,
-            0b11111100,
-            0b11111110
-        },
-        // 1, Page 1
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100011,
-            0b11110111,
-            0b11111111
-        },
-        // 1, Page 2
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00001111,
-            0b00011111,
-            0b00111111
-        }
-    },
-    {
-        // 2, Page 0
-        {
-            0b00000000,
-            0b00000001,
-            0b00000011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 2, Page 1
-        {
-            0b11111000,
-            0b11110100,
-            0b11101100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011011,
-            0b00010111,
-            0b00001111
-        },
-        // 2, Page 2
-        {
-            0b00111111,
-            0b01011111,
-            0b01101111,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01100000,
-            0b01000000,
-            0b00000000
-        }
-    },
-    {
-        // 3, Page 0
-        {
-            0b00000000,
-            0b00000001,
-            0b00000011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 3, Page 1
-        {
-            0b00000000,
-            0b00000000,
-            0b00001000,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101011,
-            0b11110111,
-            0b11111111
-        },
-        // 3, Page 2
-        {
-            0b00000000,
-            0b01000000,
-            0b01100000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
-        }
-    },
-    {
-        // 4, Page 0
-        {
-            0b11111110,
-            0b11111100,
-            0b11111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111000,
-            0b11111100,
-            0b11111110
-        },
-        // 4, Page 1
-        {
-            0b00001111,
-            0b00010111,
-            0b00011011,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101011,
-            0b11110111,
-            0b11111111
-        },
-        // 4, Page 2
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00001111,
-            0b00011111,
-            0b00111111
-        }
-    },
-    {
-        // 5, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000011,
-            0b00000001,
-            0b00000000
-        },
-        // 5, Page 1
-        {
-            0b00001111,
-            0b00010111,
-            0b00011011,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101100,
-            0b11110100,
-            0b11111000
-        },
-        // 5, Page 2
-        {
-            0b00000000,
-            0b01000000,
-            0b01100000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
-        }
-    },
-    {
-        // 6, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000011,
-            0b00000001,
-            0b00000000
-        },
-        // 6, Page 1
-        {
-            0b11111111,
-            0b11110111,
-            0b11101011,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101100,
-            0b11110100,
-            0b11111000
-        },
-        // 6, Page 2
-        {
-            0b00111111,
-            0b01011111,
-            0b01101111,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
+static constexpr Bitmap::Pixels<SevenSegCharWidth, SevenSegCharLines> SevenSegCharset[] PROGMEM = {
+    // 0
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########.#",
+        "##.######.##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##........##",
+        "#..........#",
+        "##........##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        ".##########.",
+        "............"
+    ),
+    // 1
+    Bitmap::fromAscii(
+        "............",
+        "...........#",
+        "..........##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "..........##",
+        "...........#",
+        "..........##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "..........##",
+        "...........#",
+        "............",
+        "............"
+    ),
+    // 2
+    Bitmap::fromAscii(
+        ".##########.",
+        "..########.#",
+        "...######.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".########.##",
+        "#.########.#",
+        "##.########.",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "##.######...",
+        "#.########..",
+        ".##########.",
+        "............"
+    ),
+    // 3
+    Bitmap::fromAscii(
+        ".##########.",
+        "..########.#",
+        "...######.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "...######.##",
+        "..########.#",
+        "...######.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "...######.##",
+        "..########.#",
+        ".##########.",
+        "............"
+    ),
+    // 4
+    Bitmap::fromAscii(
+        "............",
+        "#..........#",
+        "##........##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        ".########.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "..........##",
+        "...........#",
+        "............",
+        "............"
+    ),
+    // 5
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########..",
+        "##.######...",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "##.########.",
+        "#.########.#",
+        ".########.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "...######.##",
+        "..########.#",
+        ".##########.",
+        "............"
+    ),
+    // 6
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########..",
+        "##.######...",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "##.########.",
+        "#.########.#",
+        "##.######.##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        ".##########.",
+        "............"
+    ),
+    // 7
+    Bitmap::fromAscii(
+        ".##########.",
+        "..########.#",
+        "...######.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "..........##",
+        "...........#",
+        "..........##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "..........##",
+        "...........#",
+        "............",
+        "............"
+    ),
+    // 8
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########.#",
+        "##.######.##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        "##.######.##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        ".##########.",
+        "............"
+    ),
+    // 9
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########.#",
+        "##.######.##",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "###......###",
+        "##.######.##",
+        "#.########.#",
+        ".########.##",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        ".........###",
+        "...######.##",
+        "..########.#",
+        ".##########.",
+        "............"
+    ),
+    // C
+    Bitmap::fromAscii(
+        ".##########.",
+        "#.########..",
+        "##.######...",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "##..........",
+        "#...........",
+        "##..........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "###.........",
+        "##.######...",
+        "#.########..",
+        ".##########.",
+        "............"
+    ),
+};
+
+
+constexpr auto DefaultCharCount = sizeof(DefaultCharset) / sizeof(DefaultCharset[0]);
+
+static_assert(DefaultCharCount == '~' - DefaultFirstChar + 1, "Default charset should cover the printable ASCII characters");
+static_assert(sizeof(SevenSegCharset) / sizeof(SevenSegCharset[0]) == 11, "Seven segment charset should have the digits and C");
+
+//
+// Proportional font
+//
+// Generated from DefaultCharset at compile time: the empty columns around
+// the glyphs are dropped and the rest is packed after each other. Digits
+// keep their full width, so changing numbers don't leave artifacts behind.
+//
+
+constexpr auto ProportionalSpaceWidth = 3;
+constexpr auto ProportionalGapWidth = 1;
+
+struct ProportionalGlyphSpan
+{
+    uint8_t firstColumn;
+    uint8_t width;
+};
+
+constexpr ProportionalGlyphSpan proportionalGlyphSpan(const std::size_t index)
+{
+    const auto c = static_cast<char>(DefaultFirstChar + index);
+    const auto& glyph = DefaultCharset[index].data;
+
+    if (c >= '0' && c <= '9') {
+        return { 0, DefaultCharWidth };
+    }
+
+    uint8_t first = 0;
+    while (first < DefaultCharWidth && glyph[first] == 0) {
+        ++first;
+    }
+
+    if (first == DefaultCharWidth) {
+        return { 0, ProportionalSpaceWidth };
+    }
+
+    uint8_t last = DefaultCharWidth - 1;
+    while (glyph[last] == 0) {
+        --last;
+    }
+
+    return { first, static_cast<uint8_t>(last - first + 1) };
+}
+
+constexpr std::size_t proportionalColumnCount()
+{
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < DefaultCharCount; ++i) {
+        count += proportionalGlyphSpan(i).width;
+    }
+
+    return count;
+}
+
+template <std::size_t GlyphCount, std::size_t ColumnCount>
+struct ProportionalFont
+{
+    uint8_t widths[GlyphCount];
+    uint16_t offsets[GlyphCount];
+    uint8_t columns[ColumnCount];
+};
+
+using ProportionalCharsetType = ProportionalFont<DefaultCharCount, proportionalColumnCount()>;
+
+constexpr ProportionalCharsetType buildProportionalCharset()
+{
+    ProportionalCharsetType font{};
+    uint16_t offset = 0;
+
+    for (std::size_t i = 0; i < DefaultCharCount; ++i) {
+        const auto span = proportionalGlyphSpan(i);
+
+        font.widths[i] = span.width;
+        font.offsets[i] = offset;
+
+        // The space is wider than the empty source glyph
+        for (uint8_t j = 0; j < span.width; ++j) {
+            const auto column = span.firstColumn + j;
+            font.columns[offset++] = column < DefaultCharWidth ? DefaultCharset[i].data[column] : 0;
         }
-    },
+    }
+
+    return font;
+}
+
+static constexpr ProportionalCharsetType ProportionalCharset PROGMEM = buildProportionalCharset();
+
+static_assert(ProportionalCharset.widths['i' - DefaultFirstChar] < DefaultCharWidth, "Proportional glyphs should be narrower");
+
+namespace
+{
+    bool isSupportedChar(const char c)
     {
-        // 7, Page 0
-        {
-            0b00000000,
-            0b00000001,
-            0b00000011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 7, Page 1
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100011,
-            0b11110111,
-            0b11111111
-        },
-        // 7, Page 2
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00001111,
-            0b00011111,
-            0b00111111
-        }
-    },
+        return c >= DefaultFirstChar && static_cast<std::size_t>(c - DefaultFirstChar) < DefaultCharCount;
+    }
+
+    // Copies the glyph of a fixed width character, returns its width
+    uint8_t copyChar(const char c, uint8_t* const out)
     {
-        // 8, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 8, Page 1
-        {
-            0b11111111,
-            0b11110111,
-            0b11101011,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101011,
-            0b11110111,
-            0b11111111
-        },
-        // 8, Page 2
-        {
-            0b00111111,
-            0b01011111,
-            0b01101111,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
+        const uint8_t* charData;
+
+        // If character is not supported, draw placeholder
+        if (!isSupportedChar(c)) {
+            charData = DefaultCharPlaceholder.data;
+        } else {
+            charData = DefaultCharset[c - DefaultFirstChar].data;
         }
-    },
+
+        memcpy_P(out, charData, DefaultCharWidth);
+
+        return DefaultCharWidth;
+    }
+
+    uint8_t proportionalCharWidth(const char c)
     {
-        // 9, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b11111011,
-            0b11111101,
-            0b11111110
-        },
-        // 9, Page 1
-        {
-            0b00001111,
-            0b00010111,
-            0b00011011,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b00011100,
-            0b11101011,
-            0b11110111,
-            0b11111111
-        },
-        // 9, Page 2
-        {
-            0b00000000,
-            0b01000000,
-            0b01100000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01101111,
-            0b01011111,
-            0b00111111
+        if (!isSupportedChar(c)) {
+            return DefaultCharWidth;
         }
-    },
+
+        return pgm_read_byte(&ProportionalCharset.widths[c - DefaultFirstChar]);
+    }
+
+    // Copies the glyph of a proportional character, returns its width
+    uint8_t copyProportionalChar(const char c, uint8_t* const out)
     {
-        // C, Page 0
-        {
-            0b11111110,
-            0b11111101,
-            0b11111011,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000111,
-            0b00000011,
-            0b00000001,
-            0b00000000
-        },
-        // C, Page 1
-        {
-            0b11111111,
-            0b11110111,
-            0b11100011,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000
-        },
-        // C, Page 2
-        {
-            0b00111111,
-            0b01011111,
-            0b01101111,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01110000,
-            0b01100000,
-            0b01000000,
-            0b00000000
+        if (!isSupportedChar(c)) {
+            return copyChar(c, out);
         }
-    }
-};
 
+        const auto index = c - DefaultFirstChar;
+        const auto width = pgm_read_byte(&ProportionalCharset.widths[index]);
+        const auto offset = pgm_read_word(&ProportionalCharset.offsets[index]);
 
-void drawChar(const char c, const uint8_t yOffset, const bool invert)
-{
-    const uint8_t* charData;
+        memcpy_P(out, &ProportionalCharset.columns[offset], width);
 
-    // If character is not supported, draw placeholder
-    if (c >= sizeof(DefaultCharset)) {
-        charData = DefaultCharPlaceholder;
+        return width;
     }
-    else {
-        // Get data for the next character
-        charData = DefaultCharset[c - 32];
-    }
-
-    Display::sendData(charData, DefaultCharWidth, yOffset, invert);
 }
 
 void Text::draw(const char c, const uint8_t line, const uint8_t x, const uint8_t yOffset, const bool invert)
 {
+    uint8_t charData[DefaultCharWidth];
+    copyChar(c, charData);
+
     Display::setLine(line);
     Display::setColumn(x);
-    drawChar(c, yOffset, invert);
+    Display::sendData(charData, DefaultCharWidth, yOffset, invert);
 }
 
 uint8_t Text::draw(const char* s, const uint8_t line, uint8_t x, const uint8_t yOffset, const bool invert)
 {
     const auto length = strlen(s);
 
-    Display::setLine(line);
+    if (length == 0 || x >= Display::Driver::Width) {
+        return x;
+    }
 
-    for (uint8_t i = 0; i < length; ++i) {
-        Display::setColumn(x);
+    // The whole row is collected first, so it can be sent in a single transfer
+    uint8_t row[Display::Driver::Width + DefaultCharWidth];
+    const uint8_t startX = x;
+    uint8_t columns = 0;
 
-        x += DefaultCharWidth + 1;
+    for (std::size_t i = 0; i < length; ++i) {
+        columns += copyChar(s[i], row + columns);
 
-        drawChar(s[i], yOffset, invert);
+        x += DefaultCharWidth + DefaultSpaceWidth;
 
         // Stop if the next character won't fit
         if (x > Display::Driver::Width - 1)
-            return x;
+            break;
 
         // Fill the background between letters
         if (i < length - 1) {
-            const uint8_t pattern[DefaultSpaceWidth] = { 0 };
-            for (uint8_t j = 0; j < DefaultSpaceWidth; ++j) {
-                Display::sendData(pattern, DefaultSpaceWidth, yOffset, invert);
-            }
+            memset(row + columns, 0, DefaultSpaceWidth);
+            columns += DefaultSpaceWidth;
         }
     }
 
+    Display::setLine(line);
+    Display::setColumn(startX);
+    Display::sendData(row, std::min<uint8_t>(columns, Display::Driver::Width - startX), yOffset, invert);
+
     return x;
 }
 
+uint8_t Text::drawProportional(const char* s, const uint8_t line, const uint8_t x, const uint8_t yOffset, const bool invert)
+{
+    if (x >= Display::Driver::Width) {
+        return x;
+    }
+
+    uint8_t row[Display::Driver::Width];
+    const uint8_t available = Display::Driver::Width - x;
+    uint8_t columns = 0;
+
+    for (; *s; ++s) {
+        const auto gap = columns > 0 ? ProportionalGapWidth : 0;
+
+        // Only whole characters are drawn
+        if (columns + gap + proportionalCharWidth(*s) > available)
+            break;
+
+        memset(row + columns, 0, gap);
+        columns += gap;
+        columns += copyProportionalChar(*s, row + columns);
+    }
+
+    if (columns > 0) {
+        Display::setLine(line);
+        Display::setColumn(x);
+        Display::sendData(row, columns, yOffset, invert);
+    }
+
+    return x + columns;
+}
+
+uint8_t Text::proportionalWidth(const char* s)
+{
+    unsigned width = 0;
+
+    for (; *s; ++s) {
+        width += (width > 0 ? ProportionalGapWidth : 0) + proportionalCharWidth(*s);
+    }
+
+    return std::min(width, 255u);
+}
+
 void Text::draw7Seg(const char* number, const uint8_t line, uint8_t x)
 {
     const auto length = strlen(number);
@@ -1399,12 +1657,16 @@ void Text::draw7Seg(const char* number, const uint8_t line, uint8_t x)
                     Display::setLine(line + page);
                     Display::setColumn(x);
 
-                    const uint8_t* charData = nullptr;
+                    uint8_t charData[SevenSegCharWidth] = { 0 };
+                    const uint8_t* pageData = nullptr;
 
                     if (c >= '0' && c <= '9')
-                        charData = SevenSegCharset[c - '0'][page];
+                        pageData = SevenSegCharset[c - '0'].data;
                     else if (c == 'C' || c == 'c')
-                        charData = SevenSegCharset[9 + 1][page];
+                        pageData = SevenSegCharset[9 + 1].data;
+
+                    if (pageData)
+                        memcpy_P(charData, pageData + page * SevenSegCharWidth, SevenSegCharWidth);
 
                     Display::sendData(charData, SevenSegCharWidth);
                 }
@@ -26,5 +26,11 @@ namespace Text
 {
     void draw(char c, uint8_t line, uint8_t x, uint8_t yOffset, bool invert);
     uint8_t draw(const char* s, uint8_t line, uint8_t x, uint8_t yOffset, bool invert);
+
+    // Draws with the proportional version of the default font, only whole
+    // characters are drawn. Returns the column after the text.
+    uint8_t drawProportional(const char* s, uint8_t line, uint8_t x, uint8_t yOffset, bool invert);
+    uint8_t proportionalWidth(const char* s);
+
     void draw7Seg(const char* number, uint8_t line, uint8_t x);
 }
\ No newline at end of file
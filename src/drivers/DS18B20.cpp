@@ -20,7 +20,7 @@
 
 #include "DS18B20.h"
 
-#include <Arduino.h>
+#include <pgmspace.h>
 
 using namespace Drivers;
 
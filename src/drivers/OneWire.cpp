@@ -19,41 +19,44 @@
 */
 
 #include "OneWire.h"
+#include "hal/Gpio.h"
+#include "hal/Interrupts.h"
+#include "hal/Time.h"
 
 using namespace Drivers;
 
 uint8_t Detail::OneWireImpl::reset(const int pin)
 {
-    noInterrupts();
+    Hal::Interrupts::disable();
 
     busFloat(pin);
     busLow(pin);
-    delayMicroseconds(600);
+    Hal::Time::delayMicroseconds(600);
     busFloat(pin);
-    delayMicroseconds(80);
+    Hal::Time::delayMicroseconds(80);
     const auto presence = busRead(pin);
-    delayMicroseconds(600);
+    Hal::Time::delayMicroseconds(600);
     const auto temp = busRead(pin);
 
-    interrupts();
+    Hal::Interrupts::enable();
 
     return !temp ? 2 : presence;
 }
 
 void Detail::OneWireImpl::writeBit(const int pin, const uint8_t b)
 {
-    noInterrupts();
+    Hal::Interrupts::disable();
 
     busFloat(pin);
     busLow(pin);
-    delayMicroseconds(5);
+    Hal::Time::delayMicroseconds(5);
     if (b)
         busFloat(pin);
-    delayMicroseconds(60);
+    Hal::Time::delayMicroseconds(60);
     busHigh(pin);
-    delayMicroseconds(5);
+    Hal::Time::delayMicroseconds(5);
 
-    interrupts();
+    Hal::Interrupts::enable();
 }
 
 void Detail::OneWireImpl::writeByte(const int pin, uint8_t b)
@@ -66,17 +69,17 @@ void Detail::OneWireImpl::writeByte(const int pin, uint8_t b)
 
 uint8_t Detail::OneWireImpl::readBit(const int pin)
 {
-    noInterrupts();
+    Hal::Interrupts::disable();
 
     busFloat(pin);
     busLow(pin);
-    delayMicroseconds(10);
+    Hal::Time::delayMicroseconds(10);
     busFloat(pin);
-    delayMicroseconds(10);
+    Hal::Time::delayMicroseconds(10);
     const auto data = busRead(pin);
-    delayMicroseconds(40);
+    Hal::Time::delayMicroseconds(40);
 
-    interrupts();
+    Hal::Interrupts::enable();
 
     return data;
 }
@@ -95,22 +98,22 @@ uint8_t Detail::OneWireImpl::readByte(const int pin)
 
 void Detail::OneWireImpl::busLow(const int pin)
 {
-    digitalWrite(pin, LOW);
-    pinMode(pin, OUTPUT);   
+    Hal::Gpio::write(pin, false);
+    Hal::Gpio::setMode(pin, Hal::Gpio::Mode::Output);
 }
 
 void Detail::OneWireImpl::busHigh(const int pin)
 {
-    digitalWrite(pin, HIGH);
-    pinMode(pin, OUTPUT);
+    Hal::Gpio::write(pin, true);
+    Hal::Gpio::setMode(pin, Hal::Gpio::Mode::Output);
 }
 
 void Detail::OneWireImpl::busFloat(const int pin)
 {
-    pinMode(pin, INPUT);
+    Hal::Gpio::setMode(pin, Hal::Gpio::Mode::Input);
 }
 
 uint8_t Detail::OneWireImpl::busRead(const int pin)
 {
-    return digitalRead(pin);
+    return Hal::Gpio::read(pin) ? 1 : 0;
 }
\ No newline at end of file
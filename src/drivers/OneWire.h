@@ -20,7 +20,6 @@
 
 #pragma once
 
-#include <Arduino.h>
 #include <cstdint>
 
 namespace Drivers
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <cstdint>
+#include "hal/Gpio.h"
 
-#include <Arduino.h>
-#include <esp8266_peri.h>
+#include <cstddef>
+#include <cstdint>
 
 // #define SIMPLE_I2C_DEBUG
 
@@ -34,8 +34,8 @@ public:
 
     static void init()
     {
-        pinMode(SdaPin, INPUT_PULLUP);
-        pinMode(SclPin, INPUT_PULLUP);
+        Hal::Gpio::setMode(SdaPin, Hal::Gpio::Mode::InputPullup);
+        Hal::Gpio::setMode(SclPin, Hal::Gpio::Mode::InputPullup);
     }
 
     static bool start(const uint8_t addr, const Operation op, const bool sendStopOnError = true)
@@ -147,32 +147,32 @@ public:
 private:
     static inline __attribute__((always_inline)) void sdaLow()
     {
-        GPES = (1 << SdaPin);
+        Hal::Gpio::enableOutputs(1 << SdaPin);
     }
 
     static inline __attribute__((always_inline)) void sdaHigh()
     {
-        GPEC = (1 << SdaPin);
+        Hal::Gpio::disableOutputs(1 << SdaPin);
     }
 
     static inline __attribute__((always_inline)) bool sdaRead()
     {
-        return (GPI & (1 << SdaPin)) != 0;
+        return (Hal::Gpio::readInputs() & (1 << SdaPin)) != 0;
     }
 
     static inline __attribute__((always_inline)) void sclLow()
     {
-        GPES = (1 << SclPin);
+        Hal::Gpio::enableOutputs(1 << SclPin);
     }
 
     static inline __attribute__((always_inline)) void sclHigh()
     {
-        GPEC = (1 << SclPin);
+        Hal::Gpio::disableOutputs(1 << SclPin);
     }
 
     static inline __attribute__((always_inline)) bool sclRead()
     {
-        return (GPI & (1 << SclPin)) != 0;
+        return (Hal::Gpio::readInputs() & (1 << SclPin)) != 0;
     }
 
     static void sclWalley()
@@ -189,7 +189,7 @@ private:
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
     unsigned int reg;
     for (auto i = 0; i < v; i++) {
-        reg = GPI;
+        reg = Hal::Gpio::readInputs();
     }
     (void)reg;
 #pragma GCC diagnostic pop
@@ -283,6 +283,4 @@ private:
     }
 };
 
-using I2C = SimpleI2C<4, 5, 400000>;
-
 }
\ No newline at end of file
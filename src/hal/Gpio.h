@@ -0,0 +1,139 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// GPIO access for the drivers. On the ESP8266 everything is inlined to the
+// Arduino core calls or to the GPIO registers, on the host the pins are
+// emulated by hal/native/Gpio.cpp.
+//
+// The mask functions operate on GPIO0-15 only, GPIO16 lives in the RTC block
+// and has to be read with readGpio16(). They are safe to call from interrupt
+// handlers, unlike pinMode() and digitalRead().
+
+#include <cstdint>
+
+#ifdef THERMOSTAT_NATIVE
+
+// NodeMCU pin names, as the ESP8266 core defines them
+constexpr uint8_t D0 = 16;
+constexpr uint8_t D1 = 5;
+constexpr uint8_t D2 = 4;
+constexpr uint8_t D3 = 0;
+constexpr uint8_t D4 = 2;
+constexpr uint8_t D5 = 14;
+constexpr uint8_t D6 = 12;
+constexpr uint8_t D7 = 13;
+constexpr uint8_t D8 = 15;
+
+#else
+#include <Arduino.h>
+#endif
+
+namespace Hal
+{
+namespace Gpio
+{
+    enum class Mode : uint8_t
+    {
+        Input,
+        InputPullup,
+        Output
+    };
+
+    using InterruptHandler = void (*)();
+
+#ifdef THERMOSTAT_NATIVE
+
+    void setMode(uint8_t pin, Mode mode);
+    void write(uint8_t pin, bool high);
+    bool read(uint8_t pin);
+
+    void enableOutputs(uint32_t mask);
+    void disableOutputs(uint32_t mask);
+    void clearOutputs(uint32_t mask);
+    uint32_t readInputs();
+    bool readGpio16();
+
+    void attachFallingInterrupt(uint8_t pin, InterruptHandler handler);
+
+#else
+
+    inline void setMode(const uint8_t pin, const Mode mode)
+    {
+        switch (mode) {
+            case Mode::Input:
+                pinMode(pin, INPUT);
+                break;
+
+            case Mode::InputPullup:
+                pinMode(pin, INPUT_PULLUP);
+                break;
+
+            case Mode::Output:
+                pinMode(pin, OUTPUT);
+                break;
+        }
+    }
+
+    inline void write(const uint8_t pin, const bool high)
+    {
+        digitalWrite(pin, high ? HIGH : LOW);
+    }
+
+    inline bool read(const uint8_t pin)
+    {
+        return digitalRead(pin) != LOW;
+    }
+
+    inline __attribute__((always_inline)) void enableOutputs(const uint32_t mask)
+    {
+        GPES = mask;
+    }
+
+    inline __attribute__((always_inline)) void disableOutputs(const uint32_t mask)
+    {
+        GPEC = mask;
+    }
+
+    inline __attribute__((always_inline)) void clearOutputs(const uint32_t mask)
+    {
+        GPOC = mask;
+    }
+
+    inline __attribute__((always_inline)) uint32_t readInputs()
+    {
+        return GPI;
+    }
+
+    inline __attribute__((always_inline)) bool readGpio16()
+    {
+        return (GP16I & 0x01) != 0;
+    }
+
+    inline void attachFallingInterrupt(const uint8_t pin, const InterruptHandler handler)
+    {
+        attachInterrupt(digitalPinToInterrupt(pin), handler, FALLING);
+    }
+
+#endif
+}
+}
@@ -0,0 +1,91 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// The I2C bus of the display. On the ESP8266 it's the bit-banged SimpleI2C,
+// on the host the transfers are forwarded byte by byte to an emulated device.
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef THERMOSTAT_NATIVE
+
+namespace Hal
+{
+
+class I2cDevice
+{
+public:
+    virtual ~I2cDevice() = default;
+
+    // Returns false to NACK the address
+    virtual bool start(uint8_t address, bool read) = 0;
+
+    // Returns false to NACK the byte
+    virtual bool write(uint8_t byte) = 0;
+
+    virtual uint8_t read()
+    {
+        return 0xff;
+    }
+
+    virtual void stop() = 0;
+};
+
+// Same interface as Drivers::SimpleI2C
+class I2c
+{
+public:
+    enum class Operation
+    {
+        Read,
+        Write
+    };
+
+    I2c() = delete;
+
+    static void attach(I2cDevice* device);
+
+    static void init();
+
+    static bool start(uint8_t addr, Operation op, bool sendStopOnError = true);
+    static bool write(const uint8_t* buf, std::size_t len, bool sendStopOnError = true);
+    static void end(bool sendStop = true);
+
+    static bool write(uint8_t slaveAddr, const uint8_t* buf, std::size_t len, bool sendStop = true);
+    static void read(uint8_t* buf, std::size_t len, bool sendNack = true);
+    static bool read(uint8_t slaveAddr, uint8_t* buf, std::size_t len, bool sendStop = true);
+};
+
+}
+
+#else
+
+#include "drivers/SimpleI2C.h"
+
+namespace Hal
+{
+    // SDA: GPIO4 (D2), SCL: GPIO5 (D1)
+    using I2c = Drivers::SimpleI2C<4, 5, 400000>;
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#ifdef THERMOSTAT_NATIVE
+// There are no real interrupts on the host, the emulated ones run synchronously
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+#else
+#include <Arduino.h>
+#endif
+
+namespace Hal
+{
+namespace Interrupts
+{
+#ifdef THERMOSTAT_NATIVE
+
+    inline void disable() {}
+    inline void enable() {}
+
+#else
+
+    inline __attribute__((always_inline)) void disable()
+    {
+        noInterrupts();
+    }
+
+    inline __attribute__((always_inline)) void enable()
+    {
+        interrupts();
+    }
+
+#endif
+
+    class Lock
+    {
+    public:
+        Lock()
+        {
+            disable();
+        }
+
+        ~Lock()
+        {
+            enable();
+        }
+
+        Lock(const Lock&) = delete;
+        Lock& operator=(const Lock&) = delete;
+    };
+}
+}
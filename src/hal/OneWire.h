@@ -0,0 +1,118 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// 1-Wire buses. On the ESP8266 it's the bit-banged Drivers::OneWire, on the
+// host the time slots are forwarded to an emulated device.
+
+#include <cstdint>
+
+#ifdef THERMOSTAT_NATIVE
+
+namespace Hal
+{
+
+class OneWireDevice
+{
+public:
+    virtual ~OneWireDevice() = default;
+
+    // Returns true if the device answers with a presence pulse
+    virtual bool reset() = 0;
+
+    virtual void writeBit(bool bit) = 0;
+    virtual bool readBit() = 0;
+};
+
+namespace Detail
+{
+    namespace OneWireImpl
+    {
+        void attach(int pin, OneWireDevice* device);
+
+        uint8_t reset(int pin);
+        void writeBit(int pin, uint8_t b);
+        uint8_t readBit(int pin);
+    }
+}
+
+// Same interface as Drivers::OneWire
+template <int Pin>
+class OneWire
+{
+public:
+    OneWire() = delete;
+
+    static void attach(OneWireDevice* device)
+    {
+        Detail::OneWireImpl::attach(Pin, device);
+    }
+
+    static uint8_t reset()
+    {
+        return Detail::OneWireImpl::reset(Pin);
+    }
+
+    static void writeBit(const uint8_t b)
+    {
+        Detail::OneWireImpl::writeBit(Pin, b);
+    }
+
+    static void writeByte(uint8_t b)
+    {
+        for (auto i = 0u; i < sizeof(b) * 8; ++i) {
+            writeBit(b & 0x01);
+            b >>= 1;
+        }
+    }
+
+    static uint8_t readBit()
+    {
+        return Detail::OneWireImpl::readBit(Pin);
+    }
+
+    static uint8_t readByte()
+    {
+        uint8_t data = 0;
+
+        for (auto i = 0u; i < sizeof(data) * 8; i++) {
+            if (readBit())
+                data |= (0x01 << i);
+        }
+
+        return data;
+    }
+};
+
+}
+
+#else
+
+#include "drivers/OneWire.h"
+
+namespace Hal
+{
+    template <int Pin>
+    using OneWire = Drivers::OneWire<Pin>;
+}
+
+#endif
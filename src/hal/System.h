@@ -0,0 +1,46 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#ifndef THERMOSTAT_NATIVE
+#include <Arduino.h>
+#endif
+
+namespace Hal
+{
+namespace System
+{
+#ifdef THERMOSTAT_NATIVE
+
+    // Ends the host program
+    [[noreturn]] void restart();
+
+#else
+
+    inline void restart()
+    {
+        ESP.restart();
+    }
+
+#endif
+}
+}
@@ -0,0 +1,116 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Time keeping and the CPU cycle timer. On the host the time is simulated:
+// it only advances through the delay functions and Hal::Native::advance(),
+// which keeps host runs deterministic.
+
+#include <cstdint>
+
+#ifndef THERMOSTAT_NATIVE
+#include <Arduino.h>
+#endif
+
+namespace Hal
+{
+namespace Time
+{
+#ifdef THERMOSTAT_NATIVE
+
+    uint32_t millis();
+    uint32_t micros();
+    void delay(uint32_t ms);
+    void delayMicroseconds(uint32_t us);
+
+    uint32_t cycleCount();
+    uint32_t cpuFreqMHz();
+    void delayCycles(uint32_t cycles);
+
+#else
+
+    inline __attribute__((always_inline)) uint32_t millis()
+    {
+        return ::millis();
+    }
+
+    inline __attribute__((always_inline)) uint32_t micros()
+    {
+        return ::micros();
+    }
+
+    inline void delay(const uint32_t ms)
+    {
+        ::delay(ms);
+    }
+
+    inline void delayMicroseconds(const uint32_t us)
+    {
+        ::delayMicroseconds(us);
+    }
+
+    inline __attribute__((always_inline)) uint32_t cycleCount()
+    {
+        return ESP.getCycleCount();
+    }
+
+    inline uint32_t cpuFreqMHz()
+    {
+        return ESP.getCpuFreqMHz();
+    }
+
+    inline __attribute__((always_inline)) void delayCycles(const uint32_t cycles)
+    {
+        const auto start = ESP.getCycleCount();
+        while (ESP.getCycleCount() - start < cycles) {}
+    }
+
+#endif
+}
+
+// One-shot timer firing at an absolute cycle count (timer0 on the ESP8266).
+// The handler runs in interrupt context and may re-arm the timer.
+namespace CycleTimer
+{
+    using Handler = void (*)();
+
+#ifdef THERMOSTAT_NATIVE
+
+    void attach(Handler handler);
+    void armAt(uint32_t cycles);
+
+#else
+
+    inline void attach(const Handler handler)
+    {
+        timer0_isr_init();
+        timer0_attachInterrupt(handler);
+    }
+
+    inline __attribute__((always_inline)) void armAt(const uint32_t cycles)
+    {
+        timer0_write(cycles);
+    }
+
+#endif
+}
+}
@@ -0,0 +1,154 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Native.h"
+#include "hal/Gpio.h"
+
+namespace
+{
+    constexpr uint8_t PinCount = 17;
+
+    struct Pin
+    {
+        bool outputEnabled = false;
+        bool outputLevel = false;
+
+        // -1: not driven from outside
+        int8_t inputLevel = -1;
+
+        Hal::Gpio::InterruptHandler fallingEdgeHandler = nullptr;
+    };
+
+    Pin Pins[PinCount];
+
+    bool level(const Pin& pin)
+    {
+        if (pin.outputEnabled) {
+            return pin.outputLevel;
+        }
+
+        // Floating inputs read high, all of them have pull-ups on the board
+        return pin.inputLevel != 0;
+    }
+
+    void forEachPin(uint32_t mask, void (*fn)(Pin&))
+    {
+        for (uint8_t i = 0; i < 16 && mask != 0; ++i, mask >>= 1) {
+            if (mask & 1) {
+                fn(Pins[i]);
+            }
+        }
+    }
+}
+
+void Hal::Gpio::setMode(const uint8_t pin, const Mode mode)
+{
+    if (pin < PinCount) {
+        Pins[pin].outputEnabled = mode == Mode::Output;
+    }
+}
+
+void Hal::Gpio::write(const uint8_t pin, const bool high)
+{
+    if (pin < PinCount) {
+        Pins[pin].outputLevel = high;
+    }
+}
+
+bool Hal::Gpio::read(const uint8_t pin)
+{
+    return pin < PinCount && level(Pins[pin]);
+}
+
+void Hal::Gpio::enableOutputs(const uint32_t mask)
+{
+    forEachPin(mask, [](Pin& pin) { pin.outputEnabled = true; });
+}
+
+void Hal::Gpio::disableOutputs(const uint32_t mask)
+{
+    forEachPin(mask, [](Pin& pin) { pin.outputEnabled = false; });
+}
+
+void Hal::Gpio::clearOutputs(const uint32_t mask)
+{
+    forEachPin(mask, [](Pin& pin) { pin.outputLevel = false; });
+}
+
+uint32_t Hal::Gpio::readInputs()
+{
+    uint32_t inputs = 0;
+
+    for (uint8_t i = 0; i < 16; ++i) {
+        if (level(Pins[i])) {
+            inputs |= 1u << i;
+        }
+    }
+
+    return inputs;
+}
+
+bool Hal::Gpio::readGpio16()
+{
+    return level(Pins[16]);
+}
+
+void Hal::Gpio::attachFallingInterrupt(const uint8_t pin, const InterruptHandler handler)
+{
+    if (pin < PinCount) {
+        Pins[pin].fallingEdgeHandler = handler;
+    }
+}
+
+void Hal::Native::setPinInput(const uint8_t pin, const bool high)
+{
+    if (pin >= PinCount) {
+        return;
+    }
+
+    auto& p = Pins[pin];
+    const auto wasHigh = level(p);
+
+    p.inputLevel = high ? 1 : 0;
+
+    if (wasHigh && !level(p) && p.fallingEdgeHandler) {
+        p.fallingEdgeHandler();
+    }
+}
+
+void Hal::Native::releasePinInput(const uint8_t pin)
+{
+    if (pin < PinCount) {
+        Pins[pin].inputLevel = -1;
+    }
+}
+
+bool Hal::Native::pinLevel(const uint8_t pin)
+{
+    return Gpio::read(pin);
+}
+
+void Hal::Native::Detail::resetPins()
+{
+    for (auto& pin : Pins) {
+        pin = {};
+    }
+}
@@ -0,0 +1,115 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Native.h"
+#include "hal/I2c.h"
+
+using namespace Hal;
+
+namespace
+{
+    I2cDevice* Device = nullptr;
+}
+
+void I2c::attach(I2cDevice* const device)
+{
+    Device = device;
+}
+
+void I2c::init()
+{}
+
+bool I2c::start(const uint8_t addr, const Operation op, const bool sendStopOnError)
+{
+    if (!Device) {
+        return false;
+    }
+
+    if (!Device->start(addr, op == Operation::Read)) {
+        if (sendStopOnError) {
+            Device->stop();
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+bool I2c::write(const uint8_t* const buf, const std::size_t len, const bool sendStopOnError)
+{
+    if (!Device) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < len; ++i) {
+        if (!Device->write(buf[i])) {
+            if (sendStopOnError) {
+                Device->stop();
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void I2c::end(const bool sendStop)
+{
+    if (Device && sendStop) {
+        Device->stop();
+    }
+}
+
+bool I2c::write(const uint8_t slaveAddr, const uint8_t* const buf, const std::size_t len, const bool sendStop)
+{
+    if (!start(slaveAddr, Operation::Write, sendStop)) {
+        return false;
+    }
+
+    if (!write(buf, len, sendStop)) {
+        return false;
+    }
+
+    end(sendStop);
+
+    return true;
+}
+
+void I2c::read(uint8_t* const buf, const std::size_t len, const bool)
+{
+    for (std::size_t i = 0; i < len; ++i) {
+        buf[i] = Device ? Device->read() : 0xff;
+    }
+}
+
+bool I2c::read(const uint8_t slaveAddr, uint8_t* const buf, const std::size_t len, const bool sendStop)
+{
+    if (!start(slaveAddr, Operation::Read, sendStop)) {
+        return false;
+    }
+
+    read(buf, len, true);
+    end(sendStop);
+
+    return true;
+}
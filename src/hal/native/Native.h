@@ -0,0 +1,58 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Control of the emulated hardware for host programs
+
+#include <cstdint>
+
+namespace Hal
+{
+namespace Native
+{
+    static constexpr uint32_t CpuFreqMHz = 80;
+
+    // Restores the power-on state of the time and the pins
+    void reset();
+
+    // Advances the simulated time, firing the cycle timer when it's due
+    void advanceCycles(uint64_t cycles);
+    void advanceMicros(uint64_t us);
+    void advanceMillis(uint64_t ms);
+
+    uint64_t elapsedMicros();
+
+    // Drives an input pin from outside, a falling edge fires its interrupt
+    void setPinInput(uint8_t pin, bool level);
+    void releasePinInput(uint8_t pin);
+
+    // Level seen on the pin, driven either by the MCU or from outside
+    bool pinLevel(uint8_t pin);
+
+    namespace Detail
+    {
+        void resetPins();
+        void resetTime();
+        void resetBuses();
+    }
+}
+}
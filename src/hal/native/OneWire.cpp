@@ -0,0 +1,82 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Native.h"
+#include "hal/I2c.h"
+#include "hal/OneWire.h"
+#include "hal/Time.h"
+
+using namespace Hal;
+
+namespace
+{
+    constexpr auto PinCount = 17;
+
+    OneWireDevice* Devices[PinCount] = {};
+
+    OneWireDevice* device(const int pin)
+    {
+        return pin >= 0 && pin < PinCount ? Devices[pin] : nullptr;
+    }
+}
+
+void Detail::OneWireImpl::attach(const int pin, OneWireDevice* const device)
+{
+    if (pin >= 0 && pin < PinCount) {
+        Devices[pin] = device;
+    }
+}
+
+// The time slots take as long as with Drivers::OneWire
+
+uint8_t Detail::OneWireImpl::reset(const int pin)
+{
+    Time::delayMicroseconds(1280);
+
+    const auto d = device(pin);
+    return d && d->reset() ? 0 : 1;
+}
+
+void Detail::OneWireImpl::writeBit(const int pin, const uint8_t b)
+{
+    Time::delayMicroseconds(70);
+
+    if (const auto d = device(pin)) {
+        d->writeBit(b != 0);
+    }
+}
+
+uint8_t Detail::OneWireImpl::readBit(const int pin)
+{
+    Time::delayMicroseconds(60);
+
+    const auto d = device(pin);
+    return !d || d->readBit() ? 1 : 0;
+}
+
+void Native::Detail::resetBuses()
+{
+    for (auto& d : Devices) {
+        d = nullptr;
+    }
+
+    I2c::attach(nullptr);
+}
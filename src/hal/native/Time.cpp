@@ -0,0 +1,119 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Native.h"
+#include "hal/Time.h"
+
+namespace
+{
+    uint64_t NowCycles = 0;
+
+    Hal::CycleTimer::Handler TimerHandler = nullptr;
+    bool TimerArmed = false;
+    uint64_t TimerDeadline = 0;
+}
+
+void Hal::Native::advanceCycles(const uint64_t cycles)
+{
+    const auto target = NowCycles + cycles;
+
+    // The handler may re-arm the timer, possibly for a deadline within the step
+    while (TimerArmed && TimerDeadline <= target) {
+        NowCycles = TimerDeadline;
+        TimerArmed = false;
+
+        if (TimerHandler) {
+            TimerHandler();
+        }
+    }
+
+    NowCycles = target;
+}
+
+void Hal::Native::advanceMicros(const uint64_t us)
+{
+    advanceCycles(us * CpuFreqMHz);
+}
+
+void Hal::Native::advanceMillis(const uint64_t ms)
+{
+    advanceCycles(ms * 1000 * CpuFreqMHz);
+}
+
+uint64_t Hal::Native::elapsedMicros()
+{
+    return NowCycles / CpuFreqMHz;
+}
+
+uint32_t Hal::Time::millis()
+{
+    return static_cast<uint32_t>(NowCycles / (1000 * Native::CpuFreqMHz));
+}
+
+uint32_t Hal::Time::micros()
+{
+    return static_cast<uint32_t>(NowCycles / Native::CpuFreqMHz);
+}
+
+void Hal::Time::delay(const uint32_t ms)
+{
+    Native::advanceMillis(ms);
+}
+
+void Hal::Time::delayMicroseconds(const uint32_t us)
+{
+    Native::advanceMicros(us);
+}
+
+uint32_t Hal::Time::cycleCount()
+{
+    return static_cast<uint32_t>(NowCycles);
+}
+
+uint32_t Hal::Time::cpuFreqMHz()
+{
+    return Native::CpuFreqMHz;
+}
+
+void Hal::Time::delayCycles(const uint32_t cycles)
+{
+    Native::advanceCycles(cycles);
+}
+
+void Hal::CycleTimer::attach(const Handler handler)
+{
+    TimerHandler = handler;
+}
+
+void Hal::CycleTimer::armAt(const uint32_t cycles)
+{
+    // The deadline is relative to the 32-bit counter, like on the device
+    TimerDeadline = NowCycles + static_cast<uint32_t>(cycles - static_cast<uint32_t>(NowCycles));
+    TimerArmed = true;
+}
+
+void Hal::Native::Detail::resetTime()
+{
+    NowCycles = 0;
+    TimerHandler = nullptr;
+    TimerArmed = false;
+    TimerDeadline = 0;
+}
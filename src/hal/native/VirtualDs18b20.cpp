@@ -0,0 +1,130 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "VirtualDs18b20.h"
+
+#include <cmath>
+
+namespace
+{
+    enum : uint8_t {
+        SkipRom = 0xCC,
+        ConvertT = 0x44,
+        ReadScratchpad = 0xBE
+    };
+}
+
+void VirtualDs18b20::setTemperature(const double celsius)
+{
+    _temperature = celsius;
+}
+
+uint32_t VirtualDs18b20::conversionCount() const
+{
+    return _conversions;
+}
+
+bool VirtualDs18b20::reset()
+{
+    _inputByte = 0;
+    _inputBits = 0;
+    _outputBit = 0;
+    _outputBits = 0;
+
+    return true;
+}
+
+void VirtualDs18b20::writeBit(const bool bit)
+{
+    // LSB first
+    _inputByte = (_inputByte >> 1) | (bit ? 0x80 : 0);
+
+    if (++_inputBits == 8) {
+        command(_inputByte);
+        _inputByte = 0;
+        _inputBits = 0;
+    }
+}
+
+bool VirtualDs18b20::readBit()
+{
+    // The bus is released after the scratchpad was read out
+    if (_outputBit >= _outputBits) {
+        return true;
+    }
+
+    const auto bit = (_scratchpad[_outputBit / 8] >> (_outputBit % 8)) & 1;
+    ++_outputBit;
+
+    return bit != 0;
+}
+
+void VirtualDs18b20::command(const uint8_t code)
+{
+    switch (code) {
+        case SkipRom:
+            break;
+
+        case ConvertT:
+            convert();
+            break;
+
+        case ReadScratchpad:
+            _outputBit = 0;
+            _outputBits = ScratchpadSize * 8;
+            break;
+    }
+}
+
+void VirtualDs18b20::convert()
+{
+    ++_conversions;
+
+    // 12-bit resolution: 1/16 Celsius per LSB, -55 to +125 Celsius
+    const auto clamped = std::fmin(125.0, std::fmax(-55.0, _temperature));
+    const auto raw = static_cast<int16_t>(std::lround(clamped * 16));
+
+    _scratchpad[0] = static_cast<uint16_t>(raw) & 0xff;
+    _scratchpad[1] = static_cast<uint16_t>(raw) >> 8;
+
+    updateCrc();
+}
+
+void VirtualDs18b20::updateCrc()
+{
+    // Dallas/Maxim CRC-8, polynomial x^8 + x^5 + x^4 + 1 (reflected)
+    uint8_t crc = 0;
+
+    for (auto i = 0; i < ScratchpadSize - 1; ++i) {
+        auto b = _scratchpad[i];
+
+        for (auto bit = 0; bit < 8; ++bit) {
+            const auto mix = (crc ^ b) & 0x01;
+            crc >>= 1;
+            if (mix) {
+                crc ^= 0x8C;
+            }
+            b >>= 1;
+        }
+    }
+
+    _scratchpad[ScratchpadSize - 1] = crc;
+}
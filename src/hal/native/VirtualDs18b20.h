@@ -0,0 +1,62 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Emulated DS18B20 temperature sensor on a host 1-Wire bus. Only the
+// commands used by Drivers::DS18B20 are supported: Skip ROM, Convert T and
+// Read Scratchpad. The temperature is latched by Convert T with 12-bit
+// resolution, like the real sensor does.
+
+#include "hal/OneWire.h"
+
+#include <cstdint>
+
+class VirtualDs18b20 : public Hal::OneWireDevice
+{
+public:
+    void setTemperature(double celsius);
+
+    uint32_t conversionCount() const;
+
+    // OneWireDevice
+    bool reset() override;
+    void writeBit(bool bit) override;
+    bool readBit() override;
+
+private:
+    static constexpr auto ScratchpadSize = 9;
+
+    double _temperature = 0;
+    uint32_t _conversions = 0;
+
+    uint8_t _scratchpad[ScratchpadSize] = { 0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x00 };
+
+    uint8_t _inputByte = 0;
+    uint8_t _inputBits = 0;
+
+    uint8_t _outputBit = 0;
+    uint8_t _outputBits = 0;
+
+    void command(uint8_t code);
+    void convert();
+    void updateCrc();
+};
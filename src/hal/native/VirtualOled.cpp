@@ -0,0 +1,382 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "VirtualOled.h"
+
+#include <cstdio>
+
+namespace
+{
+    // The 128 pixel wide panel is centered on the 132 columns of the SH1106
+    constexpr uint8_t SH1106ColumnOffset = 2;
+
+    // Plain PBM lines should not be longer than 70 characters
+    constexpr uint8_t PbmLineLength = 64;
+}
+
+VirtualOled::Statistics& VirtualOled::Statistics::operator+=(const Statistics& other)
+{
+    starts += other.starts;
+    controlBytes += other.controlBytes;
+    commandBytes += other.commandBytes;
+    dataBytes += other.dataBytes;
+
+    return *this;
+}
+
+VirtualOled::VirtualOled(const Controller controller)
+    : _controller(controller)
+    , _memoryMode(MemoryMode::Page)
+    , _columnEnd(ramWidth() - 1)
+{}
+
+VirtualOled::Controller VirtualOled::controller() const
+{
+    return _controller;
+}
+
+uint8_t VirtualOled::ramWidth() const
+{
+    return _controller == Controller::SH1106 ? MaxRamWidth : Width;
+}
+
+bool VirtualOled::start(const uint8_t address, const bool read)
+{
+    count(&Statistics::starts);
+
+    _addressed = address == Address && !read;
+    _expectControl = true;
+
+    return _addressed;
+}
+
+bool VirtualOled::write(const uint8_t byte)
+{
+    if (!_addressed) {
+        return false;
+    }
+
+    if (_expectControl) {
+        count(&Statistics::controlBytes);
+
+        _continuation = (byte & 0x80) != 0;
+        _dataStream = (byte & 0x40) != 0;
+        _expectControl = false;
+
+        return true;
+    }
+
+    if (_dataStream) {
+        count(&Statistics::dataBytes);
+        dataByte(byte);
+    } else {
+        count(&Statistics::commandBytes);
+        commandByte(byte);
+    }
+
+    // With the continuation bit set, only one byte follows the control byte
+    if (_continuation) {
+        _expectControl = true;
+    }
+
+    return true;
+}
+
+void VirtualOled::stop()
+{
+    _addressed = false;
+}
+
+void VirtualOled::beginFrame()
+{
+    _frame = {};
+}
+
+VirtualOled::Statistics VirtualOled::endFrame()
+{
+    const auto frame = _frame;
+    _frame = {};
+    return frame;
+}
+
+const VirtualOled::Statistics& VirtualOled::frameStatistics() const
+{
+    return _frame;
+}
+
+const VirtualOled::Statistics& VirtualOled::totalStatistics() const
+{
+    return _total;
+}
+
+uint8_t VirtualOled::ramByte(const uint8_t page, const uint8_t column) const
+{
+    if (page >= Pages || column >= ramWidth()) {
+        return 0;
+    }
+
+    return _ram[page][column];
+}
+
+bool VirtualOled::pixel(const uint8_t x, const uint8_t y) const
+{
+    if (!_poweredOn || x >= Width || y >= Height) {
+        return false;
+    }
+
+    if (_entireDisplayOn) {
+        return true;
+    }
+
+    const uint8_t row = (y + _startLine + _displayOffset) % Height;
+    const uint8_t column = x + (_controller == Controller::SH1106 ? SH1106ColumnOffset : 0);
+    const bool set = (_ram[row / 8][column] >> (row % 8)) & 1;
+
+    return set != _inverted;
+}
+
+bool VirtualOled::isPoweredOn() const
+{
+    return _poweredOn;
+}
+
+uint8_t VirtualOled::contrast() const
+{
+    return _contrast;
+}
+
+uint8_t VirtualOled::startLine() const
+{
+    return _startLine;
+}
+
+bool VirtualOled::isScrollActive() const
+{
+    return _scrollActive;
+}
+
+bool VirtualOled::writePbm(const char* const path) const
+{
+    auto f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+
+    fprintf(f, "P1\n%u %u\n", Width, Height);
+
+    for (uint8_t y = 0; y < Height; ++y) {
+        for (uint8_t x = 0; x < Width; ++x) {
+            fputc(pixel(x, y) ? '1' : '0', f);
+
+            if ((x + 1) % PbmLineLength == 0) {
+                fputc('\n', f);
+            }
+        }
+    }
+
+    return fclose(f) == 0;
+}
+
+uint32_t VirtualOled::compare(const VirtualOled& other) const
+{
+    uint32_t differences = 0;
+
+    for (uint8_t y = 0; y < Height; ++y) {
+        for (uint8_t x = 0; x < Width; ++x) {
+            if (pixel(x, y) != other.pixel(x, y)) {
+                ++differences;
+            }
+        }
+    }
+
+    return differences;
+}
+
+void VirtualOled::count(uint32_t Statistics::* const counter)
+{
+    ++(_frame.*counter);
+    ++(_total.*counter);
+}
+
+void VirtualOled::commandByte(const uint8_t byte)
+{
+    // Arguments of multi-byte commands can arrive after separate control bytes
+    if (_commandExpected == 0) {
+        _command[0] = byte;
+        _commandLength = 1;
+        _commandExpected = argumentCount(byte) + 1;
+    } else {
+        _command[_commandLength++] = byte;
+    }
+
+    if (_commandLength == _commandExpected) {
+        executeCommand();
+        _commandExpected = 0;
+    }
+}
+
+uint8_t VirtualOled::argumentCount(const uint8_t command) const
+{
+    switch (command) {
+        case 0x81: // Contrast
+        case 0xA8: // Multiplex ratio
+        case 0xD3: // Display offset
+        case 0xD5: // Clock divide ratio
+        case 0xD9: // Precharge period
+        case 0xDA: // COM pins configuration
+        case 0xDB: // VCOM deselect level
+            return 1;
+    }
+
+    if (_controller == Controller::SH1106) {
+        return command == 0xAD ? 1 : 0; // DC-DC control
+    }
+
+    switch (command) {
+        case 0x20: // Memory addressing mode
+        case 0x8D: // Charge pump
+            return 1;
+
+        case 0x21: // Column address range
+        case 0x22: // Page address range
+        case 0xA3: // Vertical scroll area
+            return 2;
+
+        case 0x29: // Vertical and horizontal scroll setup
+        case 0x2A:
+            return 5;
+
+        case 0x26: // Horizontal scroll setup
+        case 0x27:
+            return 6;
+    }
+
+    return 0;
+}
+
+void VirtualOled::executeCommand()
+{
+    const auto cmd = _command[0];
+
+    if (cmd <= 0x0F) {
+        _column = (_column & 0xF0) | (cmd & 0x0F);
+    } else if (cmd <= 0x1F) {
+        _column = (_column & 0x0F) | ((cmd & 0x0F) << 4);
+    } else if (cmd >= 0x40 && cmd <= 0x7F) {
+        _startLine = cmd & 0x3F;
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) {
+        _page = cmd & 0x07;
+    }
+
+    switch (cmd) {
+        case 0x81:
+            _contrast = _command[1];
+            break;
+
+        case 0xA4:
+        case 0xA5:
+            _entireDisplayOn = cmd & 1;
+            break;
+
+        case 0xA6:
+        case 0xA7:
+            _inverted = cmd & 1;
+            break;
+
+        case 0xAE:
+        case 0xAF:
+            _poweredOn = cmd & 1;
+            break;
+
+        case 0xD3:
+            _displayOffset = _command[1] & 0x3F;
+            break;
+    }
+
+    if (_controller != Controller::SSD1306) {
+        return;
+    }
+
+    switch (cmd) {
+        case 0x20:
+            switch (_command[1] & 0x03) {
+                case 0:
+                    _memoryMode = MemoryMode::Horizontal;
+                    break;
+                case 1:
+                    _memoryMode = MemoryMode::Vertical;
+                    break;
+                default:
+                    _memoryMode = MemoryMode::Page;
+                    break;
+            }
+            break;
+
+        case 0x21:
+            _columnStart = _command[1] & 0x7F;
+            _columnEnd = _command[2] & 0x7F;
+            _column = _columnStart;
+            break;
+
+        case 0x22:
+            _pageStart = _command[1] & 0x07;
+            _pageEnd = _command[2] & 0x07;
+            _page = _pageStart;
+            break;
+
+        case 0x2E:
+            _scrollActive = false;
+            break;
+
+        case 0x2F:
+            _scrollActive = true;
+            break;
+    }
+}
+
+void VirtualOled::dataByte(const uint8_t byte)
+{
+    if (_column < ramWidth()) {
+        _ram[_page][_column] = byte;
+    }
+
+    switch (_memoryMode) {
+        case MemoryMode::Page:
+            if (++_column >= ramWidth()) {
+                _column = 0;
+            }
+            break;
+
+        case MemoryMode::Horizontal:
+            if (_column++ >= _columnEnd) {
+                _column = _columnStart;
+                _page = _page >= _pageEnd ? _pageStart : _page + 1;
+            }
+            break;
+
+        case MemoryMode::Vertical:
+            if (_page++ >= _pageEnd) {
+                _page = _pageStart;
+                _column = _column >= _columnEnd ? _columnStart : _column + 1;
+            }
+            break;
+    }
+}
@@ -0,0 +1,152 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Emulated SSD1306/SH1106 display controller on the host I2C bus.
+//
+// The command and data stream is decoded into the controller's display RAM,
+// and the bus traffic is counted per frame. The visible image is rendered in
+// the coordinates of the firmware: the segment remap and the COM scan
+// direction are treated as the mounting of the panel, while the start line,
+// the display offset, inversion and power are applied.
+
+#include "Config.h"
+#include "hal/I2c.h"
+
+#include <cstdint>
+
+class VirtualOled : public Hal::I2cDevice
+{
+public:
+    enum class Controller : uint8_t
+    {
+        SSD1306,
+        SH1106
+    };
+
+    // Controller selected for the Display template
+#ifdef CONFIG_USE_OLED_SH1106
+    static constexpr auto DefaultController = Controller::SH1106;
+#else
+    static constexpr auto DefaultController = Controller::SSD1306;
+#endif
+
+    static constexpr uint8_t Address = 0x3C;
+    static constexpr uint8_t Width = 128;
+    static constexpr uint8_t Height = 64;
+    static constexpr uint8_t Pages = 8;
+    static constexpr uint8_t MaxRamWidth = 132;
+
+    struct Statistics
+    {
+        // One address byte is sent after each START
+        uint32_t starts = 0;
+        uint32_t controlBytes = 0;
+        uint32_t commandBytes = 0;
+        uint32_t dataBytes = 0;
+
+        uint32_t busBytes() const
+        {
+            return starts + controlBytes + commandBytes + dataBytes;
+        }
+
+        Statistics& operator+=(const Statistics& other);
+    };
+
+    explicit VirtualOled(Controller controller = DefaultController);
+
+    Controller controller() const;
+    uint8_t ramWidth() const;
+
+    // I2cDevice
+    bool start(uint8_t address, bool read) override;
+    bool write(uint8_t byte) override;
+    void stop() override;
+
+    // Traffic since the last beginFrame()
+    void beginFrame();
+    Statistics endFrame();
+    const Statistics& frameStatistics() const;
+    const Statistics& totalStatistics() const;
+
+    uint8_t ramByte(uint8_t page, uint8_t column) const;
+    bool pixel(uint8_t x, uint8_t y) const;
+
+    bool isPoweredOn() const;
+    uint8_t contrast() const;
+    uint8_t startLine() const;
+    bool isScrollActive() const;
+
+    // Writes the visible image as a plain PBM
+    bool writePbm(const char* path) const;
+
+    // Number of visible pixels differing from the other display's
+    uint32_t compare(const VirtualOled& other) const;
+
+private:
+    enum class MemoryMode : uint8_t
+    {
+        Horizontal,
+        Vertical,
+        Page
+    };
+
+    const Controller _controller;
+
+    uint8_t _ram[Pages][MaxRamWidth] = {};
+
+    bool _addressed = false;
+    bool _expectControl = false;
+    bool _continuation = false;
+    bool _dataStream = false;
+
+    uint8_t _command[7] = {};
+    uint8_t _commandLength = 0;
+    uint8_t _commandExpected = 0;
+
+    MemoryMode _memoryMode;
+    uint8_t _page = 0;
+    uint8_t _column = 0;
+    uint8_t _columnStart = 0;
+    uint8_t _columnEnd;
+    uint8_t _pageStart = 0;
+    uint8_t _pageEnd = Pages - 1;
+
+    bool _poweredOn = false;
+    bool _entireDisplayOn = false;
+    bool _inverted = false;
+    bool _scrollActive = false;
+    uint8_t _contrast = 0x80;
+    uint8_t _startLine = 0;
+    uint8_t _displayOffset = 0;
+
+    Statistics _frame;
+    Statistics _total;
+
+    void count(uint32_t Statistics::* counter);
+
+    void commandByte(uint8_t byte);
+    uint8_t argumentCount(uint8_t command) const;
+    void executeCommand();
+
+    void dataByte(uint8_t byte);
+};
@@ -0,0 +1,59 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Host stand-in for esp-iot-base's settings handler interface
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#define DECLARE_SETTINGS_STRUCT(_Name) struct __attribute__((packed)) _Name
+
+class ISettingsHandler
+{
+public:
+    enum class DefaultsLoadReason : uint8_t
+    {
+        BadHeaderMagic,
+        BadHeaderVersion,
+        BadDataChecksum
+    };
+
+    using DefaultsLoader = std::function<void(DefaultsLoadReason reason)>;
+
+    virtual ~ISettingsHandler() = default;
+
+    virtual void setDefaultsLoader(DefaultsLoader loader) = 0;
+
+    template <typename T>
+    void registerSetting(T& setting)
+    {
+        registerSetting(&setting, sizeof(T));
+    }
+
+    virtual bool load() = 0;
+    virtual bool save() = 0;
+
+protected:
+    virtual void registerSetting(void* data, std::size_t size) = 0;
+};
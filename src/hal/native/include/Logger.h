@@ -0,0 +1,101 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Host stand-in for esp-iot-base's Logger, writing to stderr. Only warnings
+// and errors are printed unless Logger::verbose is set, so the long running
+// host programs are not slowed down by the debug output.
+
+#include <pgmspace.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+class Logger
+{
+public:
+    static inline bool verbose = false;
+
+    explicit Logger(const char* category)
+        : _category(category)
+    {}
+
+    void debug(const char* fmt, ...) const __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, fmt);
+        log(false, "D", fmt, args);
+        va_end(args);
+    }
+
+    void info(const char* fmt, ...) const __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, fmt);
+        log(false, "I", fmt, args);
+        va_end(args);
+    }
+
+    void warning(const char* fmt, ...) const __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, fmt);
+        log(true, "W", fmt, args);
+        va_end(args);
+    }
+
+    void error(const char* fmt, ...) const __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, fmt);
+        log(true, "E", fmt, args);
+        va_end(args);
+    }
+
+#define LOGGER_FORWARD_P(_Name) \
+    template <typename... Args> \
+    void _Name##_P(const char* fmt, Args... args) const \
+    { \
+        _Name(fmt, args...); \
+    }
+
+    LOGGER_FORWARD_P(debug)
+    LOGGER_FORWARD_P(info)
+    LOGGER_FORWARD_P(warning)
+    LOGGER_FORWARD_P(error)
+
+#undef LOGGER_FORWARD_P
+
+private:
+    const char* const _category;
+
+    void log(const bool important, const char* level, const char* fmt, va_list args) const
+    {
+        if (!important && !verbose) {
+            return;
+        }
+
+        fprintf(stderr, "[%s] %s: ", level, _category);
+        vfprintf(stderr, fmt, args);
+        fputc('\n', stderr);
+    }
+};
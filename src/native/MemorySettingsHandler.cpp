@@ -0,0 +1,85 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "MemorySettingsHandler.h"
+
+#include <cstring>
+
+void MemorySettingsHandler::setDefaultsLoader(DefaultsLoader loader)
+{
+    _defaultsLoader = std::move(loader);
+}
+
+bool MemorySettingsHandler::load()
+{
+    // Blank storage, like an erased EERAM
+    if (_storage.size() != storageSize()) {
+        if (_defaultsLoader) {
+            _defaultsLoader(DefaultsLoadReason::BadHeaderMagic);
+        }
+
+        return false;
+    }
+
+    auto p = _storage.data();
+    for (const auto& setting : _settings) {
+        memcpy(setting.data, p, setting.size);
+        p += setting.size;
+    }
+
+    return true;
+}
+
+bool MemorySettingsHandler::save()
+{
+    _storage.resize(storageSize());
+
+    auto p = _storage.data();
+    for (const auto& setting : _settings) {
+        memcpy(p, setting.data, setting.size);
+        p += setting.size;
+    }
+
+    ++_saveCount;
+
+    return true;
+}
+
+std::size_t MemorySettingsHandler::saveCount() const
+{
+    return _saveCount;
+}
+
+void MemorySettingsHandler::registerSetting(void* const data, const std::size_t size)
+{
+    _settings.push_back({ data, size });
+}
+
+std::size_t MemorySettingsHandler::storageSize() const
+{
+    std::size_t size = 0;
+
+    for (const auto& setting : _settings) {
+        size += setting.size;
+    }
+
+    return size;
+}
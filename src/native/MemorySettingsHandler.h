@@ -0,0 +1,59 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Settings handler for host programs, persisting into a RAM buffer
+// in place of the EERAM
+
+#include <ISettingsHandler.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MemorySettingsHandler : public ISettingsHandler
+{
+public:
+    void setDefaultsLoader(DefaultsLoader loader) override;
+
+    bool load() override;
+    bool save() override;
+
+    std::size_t saveCount() const;
+
+protected:
+    void registerSetting(void* data, std::size_t size) override;
+
+private:
+    struct Setting
+    {
+        void* data;
+        std::size_t size;
+    };
+
+    DefaultsLoader _defaultsLoader;
+    std::vector<Setting> _settings;
+    std::vector<uint8_t> _storage;
+    std::size_t _saveCount = 0;
+
+    std::size_t storageSize() const;
+};
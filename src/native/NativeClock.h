@@ -0,0 +1,51 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// System clock for host programs, following the simulated HAL time
+
+#include <SystemClock.h>
+
+#include "hal/native/Native.h"
+
+class NativeClock : public ISystemClock
+{
+public:
+    explicit NativeClock(const std::time_t startTime, const int utcOffsetSecs = 0)
+        : _startTime(startTime)
+        , _utcOffsetSecs(utcOffsetSecs)
+    {}
+
+    std::time_t utcTime() const override
+    {
+        return _startTime + static_cast<std::time_t>(Hal::Native::elapsedMicros() / 1000000);
+    }
+
+    std::time_t localTime() const override
+    {
+        return utcTime() + _utcOffsetSecs;
+    }
+
+private:
+    const std::time_t _startTime;
+    const int _utcOffsetSecs;
+};
@@ -0,0 +1,161 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// Host program running the thermostat components on the emulated hardware.
+// Usage:
+//  program [minutes] [screen.pbm]
+//  program sim [key=value...]  see sim/Simulation.cpp
+//  program replay <trace>      see sim/Replay.cpp
+//  program bench [key=value...] see bench/RenderBenchmark.cpp
+//  program bench format [key=value...]  see bench/FormatBenchmark.cpp
+
+// The unit tests of "pio test -e native" bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+#include "MemorySettingsHandler.h"
+#include "NativeClock.h"
+
+#include "BusConfig.h"
+#include "Format.h"
+#include "HeatingController.h"
+#include "Keypad.h"
+#include "Settings.h"
+#include "TaskScheduler.h"
+#include "TemperatureHistory.h"
+#include "TemperatureSensor.h"
+
+#include "hal/Gpio.h"
+#include "hal/Time.h"
+#include "hal/native/Native.h"
+#include "hal/native/VirtualDs18b20.h"
+#include "hal/native/VirtualOled.h"
+#include "bench/FormatBenchmark.h"
+#include "bench/RenderBenchmark.h"
+#include "sim/Replay.h"
+#include "sim/Simulation.h"
+#include "ui/Ui.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    // 2026-10-19 00:00:00 UTC
+    constexpr std::time_t StartTime = 1792368000;
+
+    constexpr auto SlowLoopUpdateIntervalMs = 500;
+
+    // Constant reading of the emulated sensor, in Celsius
+    constexpr auto RoomTemperature = 21.5;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "sim") == 0) {
+        return Simulation::main(argc - 1, argv + 1);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "replay") == 0) {
+        return Replay::main(argc - 1, argv + 1);
+    }
+
+    if (argc > 2 && strcmp(argv[1], "bench") == 0 && strcmp(argv[2], "format") == 0) {
+        return FormatBenchmark::main(argc - 2, argv + 2);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        return RenderBenchmark::main(argc - 1, argv + 1);
+    }
+
+    const auto minutes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 60;
+
+    Hal::Native::reset();
+
+    VirtualOled oled;
+    Hal::I2c::attach(&oled);
+
+    VirtualDs18b20 sensor;
+    Peripherals::Bus::MainTemperatureOneWire::attach(&sensor);
+    sensor.setTemperature(RoomTemperature);
+
+    MemorySettingsHandler settingsHandler;
+    Settings settings{ settingsHandler };
+    NativeClock clock{ StartTime };
+    TemperatureSensor temperatureSensor{ settings };
+    HeatingController heatingController{ settings, clock, temperatureSensor };
+    Keypad keypad;
+    TemperatureHistory temperatureHistory;
+    Ui ui{ settings, clock, keypad, heatingController, temperatureSensor, temperatureHistory };
+
+    TaskScheduler scheduler;
+
+    scheduler.schedulePeriodic(Keypad::ScanIntervalMs, [&ui] {
+        ui.task();
+    });
+
+    scheduler.schedulePeriodic(TemperatureSensor::UpdateIntervalMs, [&temperatureSensor] {
+        temperatureSensor.task();
+    });
+
+    scheduler.schedulePeriodic(SlowLoopUpdateIntervalMs, [&heatingController, &ui] {
+        heatingController.task();
+        ui.update();
+    });
+
+    const uint64_t endMicros = static_cast<uint64_t>(minutes) * 60 * 1000000;
+    uint32_t relaySwitches = 0;
+    auto relayActive = Hal::Native::pinLevel(D8);
+
+    while (Hal::Native::elapsedMicros() < endMicros) {
+        scheduler.run(Hal::Time::millis());
+        Hal::Native::advanceMillis(std::max<uint32_t>(1, scheduler.msUntilNextJob()));
+
+        if (Hal::Native::pinLevel(D8) != relayActive) {
+            relayActive = !relayActive;
+            ++relaySwitches;
+        }
+    }
+
+    printf("simulated minutes: %lu\n", minutes);
+    char temperature[Format::TenthsBufferSize];
+    char target[Format::TenthsBufferSize];
+    Format::tenths(temperature, heatingController.currentTemp());
+    Format::tenths(target, heatingController.targetTemp());
+
+    printf("temperature: %s C, target: %s C\n", temperature, target);
+    printf("relay: %s, switches: %u\n", relayActive ? "on" : "off", relaySwitches);
+    printf("settings saves: %zu\n", settingsHandler.saveCount());
+
+    const auto& i2c = oled.totalStatistics();
+    printf("display: %u transactions, %u bytes (%u command, %u data)\n",
+        i2c.starts, i2c.busBytes(), i2c.commandBytes, i2c.dataBytes);
+
+    if (argc > 2 && !oled.writePbm(argv[2])) {
+        fprintf(stderr, "failed to write %s\n", argv[2]);
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif
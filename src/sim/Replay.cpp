@@ -0,0 +1,490 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Replay.h"
+
+#include "BusConfig.h"
+#include "HeatingController.h"
+#include "Keypad.h"
+#include "RemoteCommand.h"
+#include "Settings.h"
+#include "TaskScheduler.h"
+#include "TemperatureHistory.h"
+#include "TemperatureSensor.h"
+#include "Trace.h"
+
+#include "hal/Gpio.h"
+#include "hal/Time.h"
+#include "hal/native/Native.h"
+#include "hal/native/VirtualDs18b20.h"
+#include "hal/native/VirtualOled.h"
+#include "native/MemorySettingsHandler.h"
+#include "ui/Ui.h"
+
+#include <SystemClock.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace
+{
+    constexpr auto SlowLoopUpdateIntervalMs = 500;
+
+    // Replayed relay switches are expected within this time of the recorded
+    // ones. The replayed sensor readings are latched by the next conversion,
+    // so they can lag by up to two sensor periods.
+    constexpr uint32_t MatchToleranceMs = 3 * TemperatureSensor::UpdateIntervalMs + SlowLoopUpdateIntervalMs;
+
+    // Time to let the components react to the last record
+    constexpr uint32_t SettleTimeMs = MatchToleranceMs;
+
+    // System clock following the simulated time, synchronized by the Time records
+    class ReplayClock : public ISystemClock
+    {
+    public:
+        void sync(const std::time_t utc, const int16_t utcOffsetMins)
+        {
+            _base = utc - elapsedSecs();
+            _utcOffsetSecs = utcOffsetMins * 60;
+        }
+
+        std::time_t utcTime() const override
+        {
+            return _base + elapsedSecs();
+        }
+
+        std::time_t localTime() const override
+        {
+            return utcTime() + _utcOffsetSecs;
+        }
+
+    private:
+        std::time_t _base = 0;
+        int _utcOffsetSecs = 0;
+
+        static std::time_t elapsedSecs()
+        {
+            return static_cast<std::time_t>(Hal::Native::elapsedMicros() / 1000000);
+        }
+    };
+
+    struct Switch
+    {
+        uint64_t timeMs;
+        bool active;
+    };
+
+    bool base64Decode(const char* text, const std::size_t length, std::vector<uint8_t>& out)
+    {
+        uint32_t group = 0;
+        uint8_t bits = 0;
+
+        for (std::size_t i = 0; i < length && text[i] != '='; ++i) {
+            const auto c = text[i];
+            uint8_t value;
+
+            if (c >= 'A' && c <= 'Z') {
+                value = c - 'A';
+            } else if (c >= 'a' && c <= 'z') {
+                value = c - 'a' + 26;
+            } else if (c >= '0' && c <= '9') {
+                value = c - '0' + 52;
+            } else if (c == '+') {
+                value = 62;
+            } else if (c == '/') {
+                value = 63;
+            } else {
+                return false;
+            }
+
+            group = (group << 6) | value;
+            bits += 6;
+
+            if (bits >= 8) {
+                bits -= 8;
+                out.push_back((group >> bits) & 0xff);
+            }
+        }
+
+        return true;
+    }
+
+    bool parseChunk(const std::string& line, unsigned& seq, unsigned& count, std::vector<uint8_t>& data)
+    {
+        const auto json = line.find('{');
+        if (json == std::string::npos) {
+            return false;
+        }
+
+        if (sscanf(line.c_str() + json, R"({"seq":%u,"count":%u,"data":")", &seq, &count) != 2) {
+            return false;
+        }
+
+        const auto begin = line.find(R"("data":")", json);
+        const auto end = line.find('"', begin + 8);
+        if (begin == std::string::npos || end == std::string::npos) {
+            return false;
+        }
+
+        return base64Decode(line.c_str() + begin + 8, end - begin - 8, data);
+    }
+
+    void matchSwitches(const std::vector<Switch>& recorded, const std::vector<Switch>& replayed, Replay::Result& result)
+    {
+        result.recordedSwitches = recorded.size();
+        result.replayedSwitches = replayed.size();
+
+        uint64_t deviationSum = 0;
+        std::size_t j = 0;
+
+        for (const auto& r : recorded) {
+            // Replayed switches too early for this one are left unmatched
+            while (j < replayed.size() && replayed[j].timeMs + MatchToleranceMs < r.timeMs) {
+                ++j;
+            }
+
+            if (j == replayed.size()) {
+                break;
+            }
+
+            const auto& p = replayed[j];
+            const auto deviation = p.timeMs > r.timeMs ? p.timeMs - r.timeMs : r.timeMs - p.timeMs;
+
+            if (p.active != r.active || deviation > MatchToleranceMs) {
+                continue;
+            }
+
+            ++result.matchedSwitches;
+            result.maxDeviationMs = std::max<uint32_t>(result.maxDeviationMs, deviation);
+            deviationSum += deviation;
+            ++j;
+        }
+
+        if (result.matchedSwitches > 0) {
+            result.meanDeviationMs = static_cast<double>(deviationSum) / result.matchedSwitches;
+        }
+    }
+}
+
+bool Replay::load(const char* const path, std::vector<uint8_t>& dump)
+{
+    std::ifstream file{ path, std::ios::binary };
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", path);
+        return false;
+    }
+
+    const std::string content{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+    const auto magic = Trace::Header::MagicValue;
+    if (content.size() >= sizeof(magic) && memcmp(content.data(), &magic, sizeof(magic)) == 0) {
+        dump.assign(content.begin(), content.end());
+        return true;
+    }
+
+    std::vector<std::vector<uint8_t>> chunks;
+    std::vector<bool> received;
+    std::size_t lineStart = 0;
+
+    while (lineStart < content.size()) {
+        auto lineEnd = content.find('\n', lineStart);
+        if (lineEnd == std::string::npos) {
+            lineEnd = content.size();
+        }
+
+        const auto line = content.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        unsigned seq = 0;
+        unsigned count = 0;
+        std::vector<uint8_t> data;
+
+        if (!parseChunk(line, seq, count, data)) {
+            continue;
+        }
+
+        if (seq >= count || (!chunks.empty() && count != chunks.size())) {
+            fprintf(stderr, "inconsistent chunk: seq=%u, count=%u\n", seq, count);
+            return false;
+        }
+
+        chunks.resize(count);
+        received.resize(count);
+        chunks[seq] = std::move(data);
+        received[seq] = true;
+    }
+
+    if (chunks.empty()) {
+        fprintf(stderr, "no trace data found in %s\n", path);
+        return false;
+    }
+
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        if (!received[i]) {
+            fprintf(stderr, "missing chunk: seq=%zu\n", i);
+            return false;
+        }
+
+        dump.insert(dump.end(), chunks[i].begin(), chunks[i].end());
+    }
+
+    return true;
+}
+
+bool Replay::run(const std::vector<uint8_t>& dump, Result& result)
+{
+    Trace::Header header;
+
+    if (dump.size() < sizeof(header)) {
+        fprintf(stderr, "trace is too short\n");
+        return false;
+    }
+
+    memcpy(&header, dump.data(), sizeof(header));
+
+    if (header.magic != Trace::Header::MagicValue || header.headerSize != sizeof(header)) {
+        fprintf(stderr, "incompatible trace header: magic=%08x, size=%u\n", header.magic, header.headerSize);
+        return false;
+    }
+
+    result = {};
+    result.droppedRecords = header.droppedRecords;
+
+    const auto records = dump.data() + sizeof(header);
+    const auto recordsSize = dump.size() - sizeof(header);
+
+    // Skip to the first Time record, the replay starts there
+    Trace::Record record;
+    Trace::Reader reader{ records, recordsSize };
+    int16_t initialReading = 0;
+    bool started = false;
+
+    while (reader.next(record)) {
+        if (record.type == Trace::RecordType::Time) {
+            // Relative to a record that's not replayed
+            record.deltaMs = 0;
+            started = true;
+            break;
+        }
+
+        if (record.type == Trace::RecordType::SensorReading) {
+            initialReading = record.value;
+        }
+
+        ++result.records;
+        ++result.skippedRecords;
+    }
+
+    if (!started) {
+        fprintf(stderr, "no Time record in the trace\n");
+        return false;
+    }
+
+    // The sensor reading is only recorded when it changes
+    {
+        Trace::Reader lookahead = reader;
+        Trace::Record next;
+
+        while (lookahead.next(next)) {
+            if (next.type == Trace::RecordType::SensorReading) {
+                initialReading = next.value;
+                break;
+            }
+        }
+    }
+
+    Hal::Native::reset();
+
+    VirtualDs18b20 sensor;
+    Peripherals::Bus::MainTemperatureOneWire::attach(&sensor);
+
+    VirtualOled oled;
+    Hal::I2c::attach(&oled);
+
+    MemorySettingsHandler settingsHandler;
+    Settings settings{ settingsHandler };
+    settings.data = header.settings;
+
+    ReplayClock clock;
+    clock.sync(record.value, record.utcOffsetMins);
+
+    TemperatureSensor temperatureSensor{ settings };
+    HeatingController heatingController{ settings, clock, temperatureSensor };
+    Keypad keypad;
+    TemperatureHistory temperatureHistory;
+    Ui ui{ settings, clock, keypad, heatingController, temperatureSensor, temperatureHistory };
+
+    // Start with a valid reading and target, like the device does at the time of the record
+    sensor.setTemperature(initialReading / 100.0);
+    temperatureSensor.task();
+    temperatureSensor.task();
+    heatingController.task();
+
+    TaskScheduler scheduler;
+
+    scheduler.schedulePeriodic(Keypad::ScanIntervalMs, [&ui] {
+        ui.task();
+    });
+
+    scheduler.schedulePeriodic(TemperatureSensor::UpdateIntervalMs, [&temperatureSensor] {
+        temperatureSensor.task();
+    });
+
+    scheduler.schedulePeriodic(SlowLoopUpdateIntervalMs, [&heatingController, &ui] {
+        heatingController.task();
+        ui.update();
+    });
+
+    const auto startMicros = Hal::Native::elapsedMicros();
+
+    std::vector<Switch> recordedSwitches;
+    std::vector<Switch> replayedSwitches;
+    bool recordedRelay = false;
+    bool recordedRelayKnown = false;
+    auto replayedRelay = Hal::Native::pinLevel(D8);
+
+    const auto runUntil = [&](const uint64_t timeMs) {
+        while ((Hal::Native::elapsedMicros() - startMicros) / 1000 < timeMs) {
+            scheduler.run(Hal::Time::millis());
+
+            const auto nowMs = (Hal::Native::elapsedMicros() - startMicros) / 1000;
+            const auto stepMs = std::min<uint64_t>(scheduler.msUntilNextJob(), timeMs - nowMs);
+            Hal::Native::advanceMillis(std::max<uint32_t>(1, stepMs));
+
+            if (Hal::Native::pinLevel(D8) != replayedRelay) {
+                replayedRelay = !replayedRelay;
+                replayedSwitches.push_back({ nowMs, replayedRelay });
+            }
+        }
+    };
+
+    uint64_t recordTimeMs = 0;
+
+    // The first Time record was read above
+    do {
+        recordTimeMs += record.deltaMs;
+        runUntil(recordTimeMs);
+
+        ++result.records;
+
+        switch (record.type) {
+            case Trace::RecordType::Time:
+                if (std::llabs(clock.utcTime() - record.value) > 1) {
+                    ++result.clockJumps;
+                }
+
+                clock.sync(record.value, record.utcOffsetMins);
+                break;
+
+            case Trace::RecordType::SensorReading:
+                ++result.sensorReadings;
+                sensor.setTemperature(record.value / 100.0);
+                break;
+
+            case Trace::RecordType::KeyEvent: {
+                ++result.keyEvents;
+
+                Keypad::KeyEvent event;
+                event.key = static_cast<Keypad::Keys>(record.value);
+                event.type = static_cast<Keypad::KeyEvent::Type>(record.code);
+                event.timestamp = Hal::Time::millis();
+
+                ui.handleKeyPress(event);
+                break;
+            }
+
+            case Trace::RecordType::RemoteCommand:
+                if (record.code < static_cast<uint8_t>(RemoteCommand::Type::_Count)) {
+                    ++result.remoteCommands;
+
+                    const RemoteCommand command{
+                        static_cast<RemoteCommand::Type>(record.code),
+                        static_cast<int16_t>(record.value)
+                    };
+
+                    command.apply(heatingController);
+                }
+                break;
+
+            case Trace::RecordType::Relay:
+                // Relay records are repeated after the Time records
+                if (!recordedRelayKnown || record.code != recordedRelay) {
+                    if (recordedRelayKnown) {
+                        recordedSwitches.push_back({ recordTimeMs, record.code != 0 });
+                    }
+
+                    recordedRelay = record.code != 0;
+                    recordedRelayKnown = true;
+                }
+                break;
+
+            case Trace::RecordType::_Count:
+                break;
+        }
+    } while (reader.next(record));
+
+    runUntil(recordTimeMs + SettleTimeMs);
+
+    matchSwitches(recordedSwitches, replayedSwitches, result);
+    result.replayedHours = recordTimeMs / 3600e3;
+
+    return true;
+}
+
+int Replay::main(const int argc, char* argv[])
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: replay <trace>\n");
+        return 2;
+    }
+
+    std::vector<uint8_t> dump;
+    if (!load(argv[1], dump)) {
+        return 2;
+    }
+
+    Result result;
+    if (!run(dump, result)) {
+        return 2;
+    }
+
+    printf("records:         %u (%u skipped before the first Time record, %u dropped on the device)\n",
+        result.records, result.skippedRecords, result.droppedRecords);
+    printf("inputs:          %u sensor readings, %u key events, %u remote commands\n",
+        result.sensorReadings, result.keyEvents, result.remoteCommands);
+    printf("clock jumps:     %u\n", result.clockJumps);
+    printf("replayed hours:  %.2f\n", result.replayedHours);
+    printf("relay switches:  %u recorded, %u replayed, %u matched\n",
+        result.recordedSwitches, result.replayedSwitches, result.matchedSwitches);
+    printf("switch timing:   mean %.0f ms, max %u ms\n", result.meanDeviationMs, result.maxDeviationMs);
+
+    const auto identical = result.matchedSwitches == result.recordedSwitches
+        && result.matchedSwitches == result.replayedSwitches;
+
+    printf("result:          %s\n", identical ? "match" : "MISMATCH");
+
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Replays a trace dumped by TraceRecorder on the emulated hardware: the
+// recorded sensor readings, key events and remote commands are fed into
+// the thermostat components at their original times, then the relay
+// transitions of the replay are compared against the recorded ones.
+
+#include <cstdint>
+#include <vector>
+
+namespace Replay
+{
+    struct Result
+    {
+        uint32_t records = 0;
+
+        // Records before the first Time record can't be placed in time
+        uint32_t skippedRecords = 0;
+
+        uint32_t droppedRecords = 0;
+        uint32_t sensorReadings = 0;
+        uint32_t keyEvents = 0;
+        uint32_t remoteCommands = 0;
+        uint32_t clockJumps = 0;
+
+        uint32_t recordedSwitches = 0;
+        uint32_t replayedSwitches = 0;
+        uint32_t matchedSwitches = 0;
+
+        // Timing of the matched relay switches, replayed against recorded
+        uint32_t maxDeviationMs = 0;
+        double meanDeviationMs = 0;
+
+        double replayedHours = 0;
+    };
+
+    // Loads a dump either as raw bytes or from the MQTT messages, one JSON
+    // object per line, as printed by e.g. mosquitto_sub -t thermostat/trace
+    bool load(const char* path, std::vector<uint8_t>& dump);
+
+    bool run(const std::vector<uint8_t>& dump, Result& result);
+
+    // Host program entry, the argument is the path of the dump
+    int main(int argc, char* argv[]);
+}
@@ -0,0 +1,338 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Simulation.h"
+
+#include "BusConfig.h"
+#include "HeatingController.h"
+#include "Settings.h"
+#include "TaskScheduler.h"
+#include "TemperatureSensor.h"
+
+#include "hal/Gpio.h"
+#include "hal/Time.h"
+#include "hal/native/Native.h"
+#include "hal/native/VirtualDs18b20.h"
+#include "native/MemorySettingsHandler.h"
+#include "native/NativeClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    // Monday, 2026-10-19 00:00:00 UTC
+    constexpr std::time_t StartTime = 1792368000;
+
+    constexpr auto HeatingControllerIntervalMs = 500;
+    constexpr uint64_t MicrosPerDay = 86400ull * 1000000;
+
+    // xorshift32 with Box-Muller, so the noise is the same on every host
+    class Noise
+    {
+    public:
+        Noise(const double sigma, const uint32_t seed)
+            : _sigma(sigma)
+            , _state(seed != 0 ? seed : 1)
+        {}
+
+        double next()
+        {
+            if (_sigma == 0) {
+                return 0;
+            }
+
+            const auto u1 = (nextRandom() + 1.0) / 4294967297.0;
+            const auto u2 = nextRandom() / 4294967296.0;
+
+            return _sigma * std::sqrt(-2 * std::log(u1)) * std::cos(2 * M_PI * u2);
+        }
+
+    private:
+        const double _sigma;
+        uint32_t _state;
+
+        uint32_t nextRandom()
+        {
+            _state ^= _state << 13;
+            _state ^= _state >> 17;
+            _state ^= _state << 5;
+            return _state;
+        }
+    };
+
+    void configure(Settings::Data& data, const Simulation::Config& config)
+    {
+        auto& hc = data.HeatingController;
+        hc.Overshoot = config.overshoot;
+        hc.Undershoot = config.undershoot;
+        hc.BoostIntervalMins = config.boostIntervalMins;
+        hc.DaytimeTemp = config.daytimeTemp;
+        hc.NightTimeTemp = config.nightTimeTemp;
+
+        data.Scheduler.Enabled = 1;
+
+        for (auto& day : data.Scheduler.DayData) {
+            memset(day, 0, sizeof(day));
+
+            for (auto i = config.daytimeStart; i < config.daytimeEnd && i < 48; ++i) {
+                day[i >> 3] |= 1 << (i & 0b111);
+            }
+        }
+    }
+}
+
+Simulation::Result Simulation::run(const Config& config)
+{
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    Hal::Native::reset();
+
+    VirtualDs18b20 sensor;
+    Peripherals::Bus::MainTemperatureOneWire::attach(&sensor);
+
+    MemorySettingsHandler settingsHandler;
+    Settings settings{ settingsHandler };
+    configure(settings.data, config);
+
+    NativeClock clock{ StartTime };
+    ThermalModel model{ config.model };
+    Noise noise{ config.sensorNoise, config.seed };
+
+    TemperatureSensor temperatureSensor{ settings };
+    HeatingController heatingController{ settings, clock, temperatureSensor };
+
+    // Start with a valid reading and target, as after the first seconds of uptime
+    sensor.setTemperature(model.sensorTemp());
+    temperatureSensor.task();
+    temperatureSensor.task();
+    heatingController.task();
+
+    TaskScheduler scheduler;
+
+    scheduler.schedulePeriodic(TemperatureSensor::UpdateIntervalMs, [&temperatureSensor] {
+        temperatureSensor.task();
+    });
+
+    scheduler.schedulePeriodic(HeatingControllerIntervalMs, [&heatingController] {
+        heatingController.task();
+    });
+
+    const auto endMicros = config.days * MicrosPerDay;
+    auto lastMicros = Hal::Native::elapsedMicros();
+
+    bool burnerOn = false;
+    uint64_t burnerMicros = 0;
+    uint64_t cycleStartMicros = 0;
+    uint64_t shortestCycleMicros = std::numeric_limits<uint64_t>::max();
+    uint64_t totalCycleMicros = 0;
+    uint32_t completedCycles = 0;
+
+    double absErrorSum = 0;
+    double squaredErrorSum = 0;
+    double weightSum = 0;
+
+    Result result;
+    result.maxUnderTarget = 0;
+    result.maxOverTarget = 0;
+
+    int64_t lastBoostDay = -1;
+
+    while (lastMicros < endMicros) {
+        const auto secondsOfDay = static_cast<double>(clock.localTime() % 86400);
+        const auto day = static_cast<int64_t>(lastMicros / MicrosPerDay);
+
+        if (config.boostAtMins >= 0 && day != lastBoostDay && secondsOfDay >= config.boostAtMins * 60) {
+            lastBoostDay = day;
+
+            if (!heatingController.isBoostActive()) {
+                heatingController.activateBoost();
+            }
+        }
+
+        sensor.setTemperature(model.sensorTemp() + noise.next());
+
+        scheduler.run(Hal::Time::millis());
+        Hal::Native::advanceMillis(std::max<uint32_t>(1, scheduler.msUntilNextJob()));
+
+        // The relay was switched by the jobs at the beginning of the step
+        const auto relay = Hal::Native::pinLevel(D8);
+        if (relay != burnerOn) {
+            if (relay) {
+                ++result.relayCycles;
+                cycleStartMicros = lastMicros;
+            } else {
+                const auto length = lastMicros - cycleStartMicros;
+                shortestCycleMicros = std::min(shortestCycleMicros, length);
+                totalCycleMicros += length;
+                ++completedCycles;
+            }
+
+            burnerOn = relay;
+        }
+
+        const auto nowMicros = Hal::Native::elapsedMicros();
+        const auto stepMicros = nowMicros - lastMicros;
+        const auto stepSecs = stepMicros / 1e6;
+
+        if (burnerOn) {
+            burnerMicros += stepMicros;
+        }
+
+        model.step(stepSecs, burnerOn, secondsOfDay);
+
+        const auto error = model.roomTemp() - heatingController.targetTemp() / 10.0;
+        absErrorSum += std::fabs(error) * stepSecs;
+        squaredErrorSum += error * error * stepSecs;
+        weightSum += stepSecs;
+        result.maxUnderTarget = std::max(result.maxUnderTarget, -error);
+        result.maxOverTarget = std::max(result.maxOverTarget, error);
+
+        lastMicros = nowMicros;
+    }
+
+    if (weightSum > 0) {
+        result.meanAbsError = absErrorSum / weightSum;
+        result.rmsError = std::sqrt(squaredErrorSum / weightSum);
+    }
+
+    result.burnerHours = burnerMicros / 3600e6;
+
+    if (completedCycles > 0) {
+        result.shortestCycleMins = shortestCycleMicros / 60e6;
+        result.meanCycleMins = totalCycleMicros / 60e6 / completedCycles;
+    }
+
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    return result;
+}
+
+namespace
+{
+    uint8_t tenths(const char* value)
+    {
+        return static_cast<uint8_t>(std::lround(atof(value) * 10));
+    }
+
+    int16_t minutesOfDay(const char* value)
+    {
+        if (strcmp(value, "none") == 0) {
+            return -1;
+        }
+
+        unsigned hours = 0;
+        unsigned minutes = 0;
+        sscanf(value, "%u:%u", &hours, &minutes);
+
+        return static_cast<int16_t>(hours * 60 + minutes);
+    }
+
+    bool parse(Simulation::Config& config, const char* key, const char* value)
+    {
+        auto& model = config.model;
+
+        const struct {
+            const char* key;
+            double* value;
+        } modelParameters[] = {
+            { "rise", &model.radiatorRise },
+            { "radiatorTau", &model.radiatorTimeConstantMins },
+            { "couplingTau", &model.couplingTimeConstantHours },
+            { "lossTau", &model.lossTimeConstantHours },
+            { "sensorTau", &model.sensorTimeConstantMins },
+            { "outdoor", &model.outdoorMean },
+            { "swing", &model.outdoorSwing },
+            { "initial", &model.initialRoomTemp },
+            { "noise", &config.sensorNoise },
+        };
+
+        for (const auto& p : modelParameters) {
+            if (strcmp(key, p.key) == 0) {
+                *p.value = atof(value);
+                return true;
+            }
+        }
+
+        if (strcmp(key, "days") == 0) {
+            config.days = strtoul(value, nullptr, 10);
+        } else if (strcmp(key, "overshoot") == 0) {
+            config.overshoot = tenths(value);
+        } else if (strcmp(key, "undershoot") == 0) {
+            config.undershoot = tenths(value);
+        } else if (strcmp(key, "boost") == 0) {
+            config.boostIntervalMins = static_cast<uint8_t>(atoi(value));
+        } else if (strcmp(key, "boostAt") == 0) {
+            config.boostAtMins = minutesOfDay(value);
+        } else if (strcmp(key, "day") == 0) {
+            config.daytimeTemp = tenths(value);
+        } else if (strcmp(key, "night") == 0) {
+            config.nightTimeTemp = tenths(value);
+        } else if (strcmp(key, "dayStart") == 0) {
+            config.daytimeStart = static_cast<uint8_t>(minutesOfDay(value) / 30);
+        } else if (strcmp(key, "dayEnd") == 0) {
+            config.daytimeEnd = static_cast<uint8_t>(minutesOfDay(value) / 30);
+        } else if (strcmp(key, "seed") == 0) {
+            config.seed = strtoul(value, nullptr, 10);
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int Simulation::main(const int argc, char* argv[])
+{
+    Config config;
+
+    for (auto i = 1; i < argc; ++i) {
+        const auto separator = strchr(argv[i], '=');
+
+        if (!separator) {
+            fprintf(stderr, "invalid argument: %s, expected key=value\n", argv[i]);
+            return 2;
+        }
+
+        *separator = '\0';
+        if (!parse(config, argv[i], separator + 1)) {
+            fprintf(stderr, "unknown parameter: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    const auto result = run(config);
+
+    printf("simulated days:  %u\n", config.days);
+    printf("comfort error:   mean %.2f K, rms %.2f K, max -%.2f/+%.2f K\n",
+        result.meanAbsError, result.rmsError, result.maxUnderTarget, result.maxOverTarget);
+    printf("relay cycles:    %u (shortest %.1f min, mean %.1f min)\n",
+        result.relayCycles, result.shortestCycleMins, result.meanCycleMins);
+    printf("burner hours:    %.1f\n", result.burnerHours);
+    printf("wall time:       %.3f s\n", result.wallSeconds);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Runs HeatingController against the thermal model on the emulated
+// hardware: the room temperature is read through the emulated DS18B20 and
+// the driver stack, and the burner follows the relay pin.
+
+#include "ThermalModel.h"
+
+#include <cstdint>
+
+namespace Simulation
+{
+    struct Config
+    {
+        ThermalModel::Parameters model;
+
+        uint32_t days = 7;
+
+        // Controller settings, temperatures in 0.1 Celsius
+        uint8_t overshoot = 5;
+        uint8_t undershoot = 5;
+        uint8_t boostIntervalMins = 10;
+        int16_t daytimeTemp = 220;
+        int16_t nightTimeTemp = 200;
+
+        // Daytime schedule for every day, in half hours
+        uint8_t daytimeStart = 6 * 2;
+        uint8_t daytimeEnd = 22 * 2;
+
+        // Daily boost activation, minutes of day, negative to disable
+        int16_t boostAtMins = 17 * 60;
+
+        // Standard deviation of the sensor noise in K, deterministic
+        double sensorNoise = 0;
+        uint32_t seed = 1;
+    };
+
+    struct Result
+    {
+        // Room temperature error against the target temperature, in K
+        double meanAbsError = 0;
+        double rmsError = 0;
+        double maxUnderTarget = 0;
+        double maxOverTarget = 0;
+
+        uint32_t relayCycles = 0;
+        double burnerHours = 0;
+        double shortestCycleMins = 0;
+        double meanCycleMins = 0;
+
+        double wallSeconds = 0;
+    };
+
+    Result run(const Config& config);
+
+    // Host program entry, parameters are given as key=value arguments
+    int main(int argc, char* argv[]);
+}
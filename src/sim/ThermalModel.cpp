@@ -0,0 +1,81 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "ThermalModel.h"
+
+#include <cmath>
+
+namespace
+{
+    constexpr double SecondsPerDay = 86400;
+    constexpr double WarmestSecondOfDay = 16 * 3600;
+}
+
+ThermalModel::ThermalModel(const Parameters& parameters)
+    : _parameters(parameters)
+    , _room(parameters.initialRoomTemp)
+    , _radiator(parameters.initialRoomTemp)
+    , _sensor(parameters.initialRoomTemp)
+{
+    step(0, false, 0);
+}
+
+void ThermalModel::step(const double seconds, const bool burnerOn, const double secondsOfDay)
+{
+    const auto& p = _parameters;
+
+    _outdoor = p.outdoorMean + p.outdoorSwing / 2
+        * std::cos(2 * M_PI * (secondsOfDay - WarmestSecondOfDay) / SecondsPerDay);
+
+    // Explicit Euler, the steps are much shorter than the time constants
+    const auto radiatorTarget = _room + (burnerOn ? p.radiatorRise : 0);
+    const auto radiatorDelta = (radiatorTarget - _radiator) * seconds / (p.radiatorTimeConstantMins * 60);
+
+    const auto heating = (_radiator - _room) / (p.couplingTimeConstantHours * 3600);
+    const auto loss = (_room - _outdoor) / (p.lossTimeConstantHours * 3600);
+    const auto roomDelta = (heating - loss) * seconds;
+
+    const auto sensorDelta = (_room - _sensor) * seconds / (p.sensorTimeConstantMins * 60);
+
+    _radiator += radiatorDelta;
+    _room += roomDelta;
+    _sensor += sensorDelta;
+}
+
+double ThermalModel::roomTemp() const
+{
+    return _room;
+}
+
+double ThermalModel::radiatorTemp() const
+{
+    return _radiator;
+}
+
+double ThermalModel::sensorTemp() const
+{
+    return _sensor;
+}
+
+double ThermalModel::outdoorTemp() const
+{
+    return _outdoor;
+}
@@ -0,0 +1,70 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+// Lumped thermal model of a room heated by a radiator, for the simulator.
+//
+// Each node is first-order:
+//  - the radiator approaches the room temperature plus its rise while the
+//    burner is on, and the room temperature while it's off,
+//  - the room is heated by the radiator and loses heat to the outside,
+//  - the sensor follows the room air with its own lag.
+// The outdoor temperature follows a daily cosine, coldest at 04:00.
+
+class ThermalModel
+{
+public:
+    struct Parameters
+    {
+        // Steady radiator temperature above the room with the burner on, in K
+        double radiatorRise = 45;
+        double radiatorTimeConstantMins = 15;
+
+        // Radiator to room and room to outside coupling
+        double couplingTimeConstantHours = 12;
+        double lossTimeConstantHours = 8;
+
+        double sensorTimeConstantMins = 5;
+
+        double outdoorMean = 2;
+        double outdoorSwing = 4;
+
+        double initialRoomTemp = 19;
+    };
+
+    explicit ThermalModel(const Parameters& parameters);
+
+    void step(double seconds, bool burnerOn, double secondsOfDay);
+
+    double roomTemp() const;
+    double radiatorTemp() const;
+    double sensorTemp() const;
+    double outdoorTemp() const;
+
+private:
+    const Parameters _parameters;
+
+    double _room;
+    double _radiator;
+    double _sensor;
+    double _outdoor = 0;
+};
@@ -0,0 +1,128 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "DisplayAnimator.h"
+
+#include "display/Display.h"
+#include "hal/Time.h"
+
+void DisplayAnimator::task()
+{
+    const auto now = Hal::Time::millis();
+
+    if (_fading) {
+        stepFade(now);
+    }
+
+    if (_rollOffset > 0) {
+        stepRoll(now);
+    }
+}
+
+void DisplayAnimator::setContrast(const uint8_t contrast)
+{
+    _fading = false;
+    Display::setContrast(contrast);
+}
+
+void DisplayAnimator::fadeIn(const uint8_t contrast)
+{
+    if (!Display::isPoweredOn()) {
+        Display::setContrast(0);
+        Display::powerOn();
+    }
+
+    startFade(contrast, false);
+}
+
+void DisplayAnimator::fadeOut()
+{
+    startFade(0, true);
+}
+
+bool DisplayAnimator::isFadingOut() const
+{
+    return _fading && _powerOffAfterFade;
+}
+
+void DisplayAnimator::rollIn()
+{
+    _rollOffset = RollInLines;
+    _rollStarted = false;
+    Display::setStartLine(_rollOffset);
+}
+
+void DisplayAnimator::startFade(const uint8_t contrast, const bool powerOff)
+{
+    _fadeFrom = Display::contrast();
+    _fadeTo = contrast;
+    _fadeStartMs = Hal::Time::millis();
+    _fading = true;
+    _powerOffAfterFade = powerOff;
+}
+
+void DisplayAnimator::stepFade(const uint32_t now)
+{
+    const auto duration = _powerOffAfterFade ? FadeOutMs : FadeInMs;
+    const auto elapsed = now - _fadeStartMs;
+
+    uint8_t contrast = _fadeTo;
+    if (elapsed < duration) {
+        const auto delta = static_cast<int32_t>(_fadeTo) - _fadeFrom;
+        contrast = _fadeFrom + delta * static_cast<int32_t>(elapsed) / static_cast<int32_t>(duration);
+    }
+
+    // Small brightness settings only need a few steps
+    if (contrast != Display::contrast()) {
+        Display::setContrast(contrast);
+    }
+
+    if (elapsed < duration) {
+        return;
+    }
+
+    _fading = false;
+
+    if (_powerOffAfterFade) {
+        Display::powerOff();
+    }
+}
+
+void DisplayAnimator::stepRoll(const uint32_t now)
+{
+    // Timed from the first step, sending the new content doesn't shorten the slide
+    if (!_rollStarted) {
+        _rollStartMs = now;
+        _rollStarted = true;
+    }
+
+    const auto elapsed = now - _rollStartMs;
+
+    uint8_t offset = 0;
+    if (elapsed < RollInMs) {
+        offset = RollInLines - RollInLines * elapsed / RollInMs;
+    }
+
+    if (offset != _rollOffset) {
+        _rollOffset = offset;
+        Display::setStartLine(offset);
+    }
+}
@@ -0,0 +1,70 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include <cstdint>
+
+// Animations done by the display controller: contrast fades and start line
+// offsets only cost a few command bytes per step, the display RAM is left
+// alone.
+//
+// Steps are timed by the clock, so the animations keep their length
+// when task() is called less often.
+class DisplayAnimator
+{
+public:
+    static constexpr uint32_t FadeInMs = 200;
+    static constexpr uint32_t FadeOutMs = 600;
+    static constexpr uint32_t RollInMs = 60;
+    static constexpr uint8_t RollInLines = 16;
+
+    void task();
+
+    void setContrast(uint8_t contrast);
+
+    // Powers on the display at zero contrast if needed
+    void fadeIn(uint8_t contrast);
+
+    // Powers off the display at the end of the fade
+    void fadeOut();
+
+    bool isFadingOut() const;
+
+    // Slides the freshly drawn content down into place. Called in a frame,
+    // the slide starts once the new content was sent.
+    void rollIn();
+
+private:
+    uint32_t _fadeStartMs = 0;
+    uint8_t _fadeFrom = 0;
+    uint8_t _fadeTo = 0;
+    bool _fading = false;
+    bool _powerOffAfterFade = false;
+
+    uint32_t _rollStartMs = 0;
+    uint8_t _rollOffset = 0;
+    bool _rollStarted = false;
+
+    void startFade(uint8_t contrast, bool powerOff);
+    void stepFade(uint32_t now);
+    void stepRoll(uint32_t now);
+};
@@ -21,12 +21,11 @@
 #include "DrawHelper.h"
 #include "Graphics.h"
 #include "Extras.h"
+#include "Format.h"
 
 #include "display/Display.h"
 #include "display/Text.h"
 
-#include <stdio.h>
-
 void draw_weekday(uint8_t x, uint8_t wday)
 {
     if (wday > 6)
@@ -49,11 +48,11 @@ void draw_mode_indicator(mode_indicator_t indicator)
 {
     switch (indicator) {
     case DH_MODE_HEATING:
-        graphics_draw_multipage_bitmap(graphics_flame_icon_20x3p, 20, 3, 92, 2);
+        graphics_draw_multipage_bitmap(graphics_flame_icon_20x3p, 92, 2);
         break;
 
     case DH_MODE_OFF:
-        graphics_draw_multipage_bitmap(graphics_off_icon_20x3p, 20, 3, 92, 2);
+        graphics_draw_multipage_bitmap(graphics_off_icon_20x3p, 92, 2);
         break;
 
     default:
@@ -169,7 +168,7 @@ void draw_temperature_value(uint8_t x, int8_t int_part, int8_t frac_part)
 
     // Draw integral part of the value
     char s[4] = { 0 };
-    sprintf(s, "%02d", int_part >= 0 ? int_part : -int_part);
+    Format::unsignedInteger(s, int_part >= 0 ? int_part : -int_part, 2, '0');
     Text::draw7Seg(s, 2, x);
 
     // Draw the decimal point
@@ -179,7 +178,7 @@ void draw_temperature_value(uint8_t x, int8_t int_part, int8_t frac_part)
     Display::sendData(dp_bitmap, sizeof(dp_bitmap), 0, false);
 
     // Draw fractional part of the value
-    sprintf(s, "%d", frac_part >= 0 ? frac_part : -frac_part);
+    Format::unsignedInteger(s, frac_part >= 0 ? frac_part : -frac_part);
     Text::draw7Seg(s, 2, x + 32);
 
     // Draw the degree symbol
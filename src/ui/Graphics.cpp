@@ -18,9 +18,119 @@
     Created on 2017-01-02
 */
 
-#include "graphics.h"
+#include "Graphics.h"
 #include "display/Display.h"
 
+namespace
+{
+    // The sources are functions, so the unpacked images are not kept in the binary
+    constexpr auto flameIcon()
+    {
+        return Bitmap::fromAscii(
+            "..........#.........",
+            ".........##.........",
+            "........###.........",
+            ".......####.........",
+            ".......##.##........",
+            "......##..##....##..",
+            "......##..##...###..",
+            "......##..##..####..",
+            "......##...#..##.##.",
+            "..#..##....##.##.##.",
+            ".###.##.....###..##.",
+            ".###.##......##..##.",
+            "##.##.#.......#...##",
+            "##.####...........##",
+            "##..###...........##",
+            "##....#...........##",
+            ".##..............##.",
+            ".##..............##.",
+            ".###............###.",
+            "..###..........###..",
+            "...###........###...",
+            "....###......###....",
+            ".....##########.....",
+            ".......######......."
+        );
+    }
+
+    static_assert(flameIcon().width == 20 && flameIcon().pages == 3, "Icon should be 20x3 pages");
+
+    constexpr auto FlameIconPacked PROGMEM = Bitmap::pack<Bitmap::packedSize(flameIcon())>(flameIcon());
+
+    constexpr auto offIcon()
+    {
+        return Bitmap::fromAscii(
+            "....................",
+            ".........##.........",
+            ".........##.........",
+            ".........##.........",
+            ".........##.........",
+            ".....##..##..##.....",
+            "....###..##..###....",
+            "...###...##...###...",
+            "..##.....##.....##..",
+            ".###.....##.....###.",
+            ".##......##......##.",
+            "##................##",
+            "##................##",
+            "##................##",
+            "##................##",
+            "##................##",
+            "##................##",
+            ".##..............##.",
+            ".###............###.",
+            "..##............##..",
+            "...###........###...",
+            "....###......###....",
+            ".....##########.....",
+            ".......######......."
+        );
+    }
+
+    static_assert(offIcon().width == 20 && offIcon().pages == 3, "Icon should be 20x3 pages");
+
+    constexpr auto OffIconPacked PROGMEM = Bitmap::pack<Bitmap::packedSize(offIcon())>(offIcon());
+
+    constexpr auto calendarIcon()
+    {
+        return Bitmap::fromAscii(
+            "....................",
+            "....................",
+            ".....#........#.....",
+            "....###......###....",
+            "....###......###....",
+            ".##################.",
+            "####################",
+            "##..###......###..##",
+            "##...#........#...##",
+            "##................##",
+            "##.....##..##..##.##",
+            "##.....##..##..##.##",
+            "##................##",
+            "##.##..##..##..##.##",
+            "##.##..##..##..##.##",
+            "##................##",
+            "##.##..##.........##",
+            "##.##..##.........##",
+            "##................##",
+            "####################",
+            ".##################.",
+            "....................",
+            "....................",
+            "...................."
+        );
+    }
+
+    static_assert(calendarIcon().width == 20 && calendarIcon().pages == 3, "Icon should be 20x3 pages");
+
+    constexpr auto CalendarIconPacked PROGMEM = Bitmap::pack<Bitmap::packedSize(calendarIcon())>(calendarIcon());
+}
+
+const Bitmap::Image graphics_flame_icon_20x3p = Bitmap::image(FlameIconPacked);
+const Bitmap::Image graphics_off_icon_20x3p = Bitmap::image(OffIconPacked);
+const Bitmap::Image graphics_calendar_icon_20x3p = Bitmap::image(CalendarIconPacked);
+
 void graphics_draw_bitmap(
     const uint8_t* bitmap,
     uint8_t width,
@@ -36,223 +146,19 @@ void graphics_draw_bitmap(
 }
 
 void graphics_draw_multipage_bitmap(
-    const uint8_t* mp_bitmap,
-    uint8_t width,
-    uint8_t lineCount,
+    const Bitmap::Image& image,
     uint8_t x,
     uint8_t startLine)
 {
-    if (startLine + lineCount > Display::Lines)
+    if (startLine + image.pages > Display::Lines || image.width == 0 || x + image.width >= Display::Width)
         return;
 
-    const uint8_t* bitmap = mp_bitmap;
+    // Pages are decoded one by one, each sent in a single transfer
+    Bitmap::Reader reader{ image };
+    uint8_t page[Display::Width];
 
-    for (uint8_t line = startLine; line < startLine + lineCount; ++line) {
-        graphics_draw_bitmap(bitmap, width, x, line);
-        bitmap += width;
+    for (uint8_t line = startLine; line < startLine + image.pages; ++line) {
+        reader.read(page, image.width);
+        graphics_draw_bitmap(page, image.width, x, line);
     }
 }
-
-const uint8_t graphics_flame_icon_20x3p[20 * 3] = {
-    // page 0
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b11100000,
-    0b11111000,
-    0b00011100,
-    0b00001110,
-    0b11111111,
-    0b11110000,
-    0b00000000,
-    0b00000000,
-    0b10000000,
-    0b11000000,
-    0b11100000,
-    0b11100000,
-    0b00000000,
-    0b00000000,
-
-    // page 1
-    0b11110000,
-    0b11111100,
-    0b00001110,
-    0b00111100,
-    0b01110000,
-    0b01101110,
-    0b11111111,
-    0b00000001,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000011,
-    0b00000110,
-    0b00001100,
-    0b00011111,
-    0b00000011,
-    0b00000000,
-    0b00001111,
-    0b11111111,
-    0b11110000,
-
-    // page 2
-    0b00000000,
-    0b00000111,
-    0b00001111,
-    0b00011100,
-    0b00111000,
-    0b01110000,
-    0b01100000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b01100000,
-    0b01110000,
-    0b00111000,
-    0b00011100,
-    0b00001111,
-    0b00000111,
-    0b00000000
-};
-
-const uint8_t graphics_off_icon_20x3p[20 * 3] = {
-    // page 0
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b10000000,
-    0b11000000,
-    0b11100000,
-    0b01100000,
-    0b00000000,
-    0b00000000,
-    0b11111110,
-    0b11111110,
-    0b00000000,
-    0b00000000,
-    0b01100000,
-    0b11100000,
-    0b11000000,
-    0b10000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-
-    // page 1
-    0b11111000,
-    0b11111110,
-    0b00000111,
-    0b00000011,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000111,
-    0b00000111,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000000,
-    0b00000011,
-    0b00000111,
-    0b11111110,
-    0b11111000,
-
-    // page 2
-    0b00000001,
-    0b00000111,
-    0b00001110,
-    0b00011100,
-    0b00110000,
-    0b01110000,
-    0b01100000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b11000000,
-    0b01100000,
-    0b01110000,
-    0b00110000,
-    0b00011100,
-    0b00001110,
-    0b00000111,
-    0b00000001
-};
-
-const uint8_t graphics_calendar_icon_20x3p[20 * 3] = {
-    // page 0
-    0b11000000,
-    0b11100000,
-    0b01100000,
-    0b01100000,
-    0b11111000,
-    0b11111100,
-    0b11111000,
-    0b01100000,
-    0b01100000,
-    0b01100000,
-    0b01100000,
-    0b01100000,
-    0b01100000,
-    0b11111000,
-    0b11111100,
-    0b11111000,
-    0b01100000,
-    0b01100000,
-    0b11100000,
-    0b11000000,
-
-    // page 1
-    0b11111111,
-    0b11111111,
-    0b00000000,
-    0b01100000,
-    0b01100000,
-    0b00000001,
-    0b00000000,
-    0b01101100,
-    0b01101100,
-    0b00000000,
-    0b00000000,
-    0b01101100,
-    0b01101100,
-    0b00000000,
-    0b00000001,
-    0b01101100,
-    0b01101100,
-    0b00000000,
-    0b11111111,
-    0b11111111,
-
-    // page 2
-    0b00001111,
-    0b00011111,
-    0b00011000,
-    0b00011011,
-    0b00011011,
-    0b00011000,
-    0b00011000,
-    0b00011011,
-    0b00011011,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011000,
-    0b00011111,
-    0b00001111
-};
\ No newline at end of file
@@ -21,11 +21,14 @@
 #ifndef GRAPHICS_H
 #define	GRAPHICS_H
 
+#include "display/Bitmap.h"
+
 #include <stdint.h>
 
-extern const uint8_t graphics_flame_icon_20x3p[];
-extern const uint8_t graphics_off_icon_20x3p[];
-extern const uint8_t graphics_calendar_icon_20x3p[];
+// Icons in flash, compressed
+extern const Bitmap::Image graphics_flame_icon_20x3p;
+extern const Bitmap::Image graphics_off_icon_20x3p;
+extern const Bitmap::Image graphics_calendar_icon_20x3p;
 
 void graphics_draw_bitmap(
     const uint8_t* bitmap,
@@ -34,9 +37,7 @@ void graphics_draw_bitmap(
     uint8_t line);
 
 void graphics_draw_multipage_bitmap(
-    const uint8_t* mp_bitmap,
-    uint8_t width,
-    uint8_t page_count,
+    const Bitmap::Image& image,
     uint8_t x,
     uint8_t start_page);
 
@@ -20,6 +20,7 @@
 
 #include "DrawHelper.h"
 #include "Extras.h"
+#include "Format.h"
 #include "Graphics.h"
 #include "HeatingController.h"
 #include "Keypad.h"
@@ -30,7 +31,6 @@
 
 #include "display/Text.h"
 
-#include <stdio.h>
 #include <string.h>
 #include <time.h>
 
@@ -40,7 +40,7 @@ MainScreen::MainScreen(
     HeatingController& heatingController,
     const TemperatureSensor& temperatureSensor
 )
-    : Screen("Main")
+    : Screen(ScreenId::Main, "Main")
     , _settings(settings)
     , _clock(clock)
     , _heatingController(heatingController)
@@ -71,6 +71,8 @@ Screen::Action MainScreen::keyPress(Keypad::Keys keys)
     // 4: boost start, extend x minutes (long: stop)
     // 5: daytime manual -> back to automatic
     // 6: nighttime manual -> back to automatic
+    // Left: temperature trend
+    // Right: scheduling
 
     if (keys & Keypad::Keys::Plus) {
         _heatingController.incTargetTemp();
@@ -80,7 +82,7 @@ Screen::Action MainScreen::keyPress(Keypad::Keys keys)
         // Avoid entering the menu while exiting
         // from another screen with long press
         if (!(keys & Keypad::Keys::LongPress)) {
-            return navigateForward("Menu");
+            return navigateForward(ScreenId::Menu);
         }
     } else if (keys & Keypad::Keys::Boost) {
         if (keys & Keypad::Keys::LongPress) {
@@ -93,10 +95,10 @@ Screen::Action MainScreen::keyPress(Keypad::Keys keys)
             else
                 _heatingController.extendBoost();
         }
-    // } else if (keys & KEY_LEFT) {
-    // 	heatctl_deactivate_boost();
+    } else if (keys & Keypad::Keys::Left) {
+        return navigateForward(ScreenId::Trend);
     } else if (keys & Keypad::Keys::Right) {
-        return navigateForward("Scheduling");
+        return navigateForward(ScreenId::Scheduling);
     }
 
     update();
@@ -118,8 +120,8 @@ void MainScreen::drawClock()
     const auto localTime = _clock.localTime();
     const struct tm* t = gmtime(&localTime);
 
-    char time_fmt[10] = { 6 };
-    sprintf(time_fmt, "%02d:%02d", t->tm_hour, t->tm_min);
+    char time_fmt[Format::HoursMinutesBufferSize];
+    Format::hoursMinutes(time_fmt, t->tm_hour, t->tm_min);
 
     Text::draw(time_fmt, 0, 0, 0, false);
     draw_weekday(33, t->tm_wday);
@@ -130,14 +132,17 @@ void MainScreen::drawTargetTempBoostIndicator()
     char s[15] = "";
 
     if (!_heatingController.isBoostActive()) {
-        uint16_t temp = _heatingController.targetTemp();
-        sprintf(s, "     %2d.%d C", temp / 10, temp % 10);
+        const int16_t temp = _heatingController.targetTemp();
+        strcpy(s, "     ");
+        const auto length = 5 + Format::tenths(s + 5, temp, 4);
+        strcpy(s + length, " C");
     } else {
         time_t secs = _heatingController.boostRemaining();
         uint16_t minutes = secs / 60;
         secs -= minutes * 60;
 
-        sprintf(s, " BST %3u:%02lld", minutes, secs);
+        strcpy(s, " BST ");
+        Format::minutesSeconds(s + 5, minutes, static_cast<uint8_t>(secs));
     }
 
     Text::draw(s, 0, 60, 0, false);
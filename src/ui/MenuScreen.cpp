@@ -19,7 +19,7 @@
 */
 
 #include "DrawHelper.h"
-#include "Extras.h"
+#include "Format.h"
 #include "Graphics.h"
 #include "HeatingController.h"
 #include "Keypad.h"
@@ -30,11 +30,10 @@
 
 #include "display/Display.h"
 #include "display/Text.h"
-
-#include <stdio.h>
+#include "hal/System.h"
 
 MenuScreen::MenuScreen(Settings& settings)
-    : Screen("Menu")
+    : Screen(ScreenId::Menu, "Menu")
     , _settings(settings)
 {
 }
@@ -273,21 +272,18 @@ void MenuScreen::updatePageHeatCtlMode()
 {
     // FIXME: proper mode name must be shown
 
-    char num[4] = { 0 };
-    sprintf(num, "%2d", _newSettings.HeatingController.Mode);
-
     Display::fillArea(0, 3, 128, 3, 0);
 
     switch (static_cast<HeatingController::Mode>(_newSettings.HeatingController.Mode)) {
     case HeatingController::Mode::Normal:
-        graphics_draw_multipage_bitmap(graphics_calendar_icon_20x3p, 20, 3, 20, 2);
-        Text::draw("NORMAL", 3, 50, 0, false);
-        Text::draw("(SCHEDULE)", 4, 50, 0, false);
+        graphics_draw_multipage_bitmap(graphics_calendar_icon_20x3p, 20, 2);
+        Text::drawProportional("NORMAL", 3, 50, 0, false);
+        Text::drawProportional("(SCHEDULE)", 4, 50, 0, false);
         break;
 
     case HeatingController::Mode::Off:
-        graphics_draw_multipage_bitmap(graphics_off_icon_20x3p, 20, 3, 20, 2);
-        Text::draw("OFF", 3, 50, 0, false);
+        graphics_draw_multipage_bitmap(graphics_off_icon_20x3p, 20, 2);
+        Text::drawProportional("OFF", 3, 50, 0, false);
         break;
 
     case HeatingController::Mode::Boost:
@@ -326,14 +322,14 @@ void MenuScreen::updatePageTempUndershoot()
 void MenuScreen::updatePageBoostIntval()
 {
     char num[4] = { 0 };
-    sprintf(num, "%2d", _newSettings.HeatingController.BoostIntervalMins);
+    Format::unsignedInteger(num, _newSettings.HeatingController.BoostIntervalMins, 2);
     Text::draw7Seg(num, 2, 20);
 }
 
 void MenuScreen::updatePageCustomTempTimeout()
 {
     char num[6] = { 0 };
-    sprintf(num, "%4u", _newSettings.HeatingController.CustomTempTimeoutMins);
+    Format::unsignedInteger(num, _newSettings.HeatingController.CustomTempTimeoutMins, 4);
     Text::draw7Seg(num, 2, 20);
 }
 
@@ -347,7 +343,7 @@ void MenuScreen::updatePageTempCorrection()
 void MenuScreen::updatePageDisplayBrightness()
 {
     char num[4] = { 0 };
-    sprintf(num, "%3d", _newSettings.Display.Brightness);
+    Format::unsignedInteger(num, _newSettings.Display.Brightness, 3);
     Text::draw7Seg(num, 2, 20);
 
     Display::setContrast(_newSettings.Display.Brightness);
@@ -356,22 +352,22 @@ void MenuScreen::updatePageDisplayBrightness()
 void MenuScreen::updatePageDisplayTimeout()
 {
     char num[4] = { 0 };
-    sprintf(num, "%3d", _newSettings.Display.TimeoutSecs);
+    Format::unsignedInteger(num, _newSettings.Display.TimeoutSecs, 3);
     Text::draw7Seg(num, 2, 20);
 }
 
 void MenuScreen::updatePageReboot()
 {
-    Text::draw("Press the (+) button", 2, 5, 0, 0);
+    Text::drawProportional("Press the (+) button", 2, 5, 0, 0);
 
     char s[] = "0 time(s) to reboot.";
     s[0] = '0' + _rebootCounter;
-    Text::draw(s, 3, 5, 0, 0);
+    Text::drawProportional(s, 3, 5, 0, 0);
 }
 
 void MenuScreen::updatePageBlynkSwitch()
 {
-    Text::draw("Disable Blynk:", 3, 5, 0, 0);
+    Text::drawProportional("Disable Blynk:", 3, 5, 0, 0);
     Text::draw(_blynkDisableValue ? "Yes" : "No ", 4, 10, 0, 0);
 }
 
@@ -386,14 +382,14 @@ void MenuScreen::updatePageWifi()
 
 void MenuScreen::drawPageTitle(const char* text)
 {
-    Text::draw(text, 0, 0, 0, false);
+    Text::drawProportional(text, 0, 0, 0, false);
 }
 
 void MenuScreen::nextPage()
 {
     if (static_cast<int>(_page) < static_cast<int>(Page::Last) - 1) {
         _page = static_cast<Page>(static_cast<int>(_page) + 1);
-        draw();
+        drawPageChange();
     }
 }
 
@@ -401,10 +397,18 @@ void MenuScreen::previousPage()
 {
     if (_page > Page::First) {
         _page = static_cast<Page>(static_cast<int>(_page) - 1);
-        draw();
+        drawPageChange();
     }
 }
 
+void MenuScreen::drawPageChange()
+{
+    // Only the title and the value differ between pages
+    Display::beginFrame();
+    draw();
+    Display::endFrame();
+}
+
 void MenuScreen::applySettings()
 {
     _settings.data = _newSettings;
@@ -418,7 +422,7 @@ void MenuScreen::applySettings()
     _settings.save();
 
     if (rebootAfterSave) {
-        ESP.restart();
+        Hal::System::restart();
     }
 }
 
@@ -443,89 +447,54 @@ void MenuScreen::adjustValue(int8_t amount)
         break;
 
     case Page::DaytimeTemp:
-        _newSettings.HeatingController.DaytimeTemp = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.DaytimeTemp,
-            amount,
-            Limits::HeatingController::DaytimeTempMin,
-            Limits::HeatingController::DaytimeTempMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::DaytimeTemp, amount);
         updatePageDaytimeTemp();
         break;
 
     case Page::NightTimeTemp:
-        _newSettings.HeatingController.NightTimeTemp = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.NightTimeTemp,
-            amount,
-            Limits::HeatingController::NightTimeTempMin,
-            Limits::HeatingController::NightTimeTempMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::NightTimeTemp, amount);
         updatePageNightTimeTemp();
         break;
 
     case Page::TempOvershoot:
-        _newSettings.HeatingController.Overshoot = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.Overshoot,
-            amount,
-            Limits::HeatingController::TempOvershootMin,
-            Limits::HeatingController::TempOvershootMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::TempOvershoot, amount);
         updatePageTempOvershoot();
         break;
 
     case Page::TempUndershoot:
-        _newSettings.HeatingController.Undershoot = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.Undershoot,
-            amount,
-            Limits::HeatingController::TempUndershootMin,
-            Limits::HeatingController::TempUndershootMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::TempUndershoot, amount);
         updatePageTempUndershoot();
         break;
 
     case Page::BoostInterval:
-        _newSettings.HeatingController.BoostIntervalMins = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.BoostIntervalMins,
-            amount,
-            Limits::HeatingController::BoostIntervalMin,
-            Limits::HeatingController::BoostIntervalMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::BoostIntervalMins, amount);
         updatePageBoostIntval();
         break;
 
     case Page::CustomTempTimeout:
-        _newSettings.HeatingController.CustomTempTimeoutMins = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.CustomTempTimeoutMins,
-            amount,
-            Limits::HeatingController::CustomTempTimeoutMin,
-            Limits::HeatingController::CustomTempTimeoutMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::CustomTempTimeoutMins, amount);
         updatePageCustomTempTimeout();
         break;
 
     case Page::DisplayBrightness:
-        _newSettings.Display.Brightness += amount;
+        Settings::adjustFieldValue(_newSettings, Settings::Field::DisplayBrightness, amount);
         updatePageDisplayBrightness();
         break;
 
     case Page::DisplayTimeout:
-        _newSettings.Display.TimeoutSecs += amount;
+        Settings::adjustFieldValue(_newSettings, Settings::Field::DisplayTimeoutSecs, amount);
         updatePageDisplayTimeout();
         break;
 
     case Page::TempCorrection:
-        _newSettings.HeatingController.TempCorrection = Extras::adjustValueWithRollOver(
-            _newSettings.HeatingController.TempCorrection,
-            amount,
-            Limits::HeatingController::TempCorrectionMin,
-            Limits::HeatingController::TempCorrectionMax
-        );
+        Settings::adjustFieldValue(_newSettings, Settings::Field::TempCorrection, amount);
         updatePageTempCorrection();
         break;
 
     case Page::Reboot:
         if (amount > 0 && --_rebootCounter == 0) {
             _log.warning_P(PSTR("initiating manual reboot"));
-            ESP.restart();
+            Hal::System::restart();
         }
         updatePageReboot();
         break;
@@ -102,6 +102,7 @@ private:
     void drawPageTitle(const char* text);
     void nextPage();
     void previousPage();
+    void drawPageChange();
     void applySettings();
     void revertSettings();
     void adjustValue(int8_t amount);
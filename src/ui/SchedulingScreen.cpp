@@ -19,11 +19,11 @@
 */
 
 #include "DrawHelper.h"
+#include "Format.h"
 #include "Graphics.h"
 #include "Keypad.h"
 #include "SchedulingScreen.h"
 #include "SystemClock.h"
-#include "main.h"
 
 #include "display/Display.h"
 #include "display/Text.h"
@@ -31,7 +31,7 @@
 #include <cstring>
 
 SchedulingScreen::SchedulingScreen(Settings& settings, const ISystemClock& systemClock)
-    : Screen("Scheduling")
+    : Screen(ScreenId::Scheduling, "Scheduling")
     , _settings(settings)
     , _systemClock(systemClock)
 {
@@ -115,8 +115,8 @@ void SchedulingScreen::drawIntervalDisplay()
     uint8_t hours = _intvalIdx >> 1;
     uint8_t mins = (_intvalIdx & 1) * 30;
 
-    char s[8] = { 0 };
-    sprintf(s, "%02u %02u", hours, mins);
+    char s[Format::HoursMinutesBufferSize];
+    Format::hoursMinutes(s, hours, mins, ' ');
 
     Text::draw7Seg(s, 2, 29);
 }
@@ -4,19 +4,33 @@
 
 #include "Keypad.h"
 
+enum class ScreenId : uint8_t
+{
+    Main,
+    Menu,
+    Scheduling,
+    Trend
+};
+
 class Screen
 {
 public:
-    explicit Screen(const char* name)
-        : _name(name)
+    Screen(const ScreenId id, const char* name)
+        : _id(id)
+        , _name(name)
     {}
 
+    ScreenId id() const
+    {
+        return _id;
+    }
+
     const char* name() const
     {
         return _name;
     }
 
-    const char* nextScreen() const
+    ScreenId nextScreen() const
     {
         return _nextScreen;
     }
@@ -28,9 +42,9 @@ public:
         NavigateForward
     };
 
-    Action navigateForward(const char* name)
+    Action navigateForward(const ScreenId id)
     {
-        _nextScreen = name;
+        _nextScreen = id;
         return Action::NavigateForward;
     }
 
@@ -41,6 +55,7 @@ public:
     virtual Action keyPress(Keypad::Keys keys) = 0;
 
 private:
+    const ScreenId _id;
     const char* const _name;
-    const char* _nextScreen = nullptr;
+    ScreenId _nextScreen = ScreenId::Main;
 };
\ No newline at end of file
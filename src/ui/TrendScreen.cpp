@@ -0,0 +1,231 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#include "Format.h"
+#include "SystemClock.h"
+#include "TrendScreen.h"
+
+#include "display/Display.h"
+#include "display/Text.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+TrendScreen::TrendScreen(const ISystemClock& systemClock, const TemperatureHistory& history)
+    : Screen(ScreenId::Trend, "Trend")
+    , _systemClock(systemClock)
+    , _history(history)
+{
+    std::fill(std::begin(_temperatures), std::end(_temperatures), NoData);
+    std::fill(std::begin(_setpoints), std::end(_setpoints), NoData);
+}
+
+void TrendScreen::activate()
+{
+    const auto slot = _systemClock.utcTime() / ColumnSecs;
+
+    rebuild(slot);
+    updateScale();
+    draw(slot);
+}
+
+void TrendScreen::update()
+{
+    const auto slot = _systemClock.utcTime() / ColumnSecs;
+
+    if (slot == _lastSlot) {
+        return;
+    }
+
+    // Redraw everything if updates were missed (e.g. clock adjustment)
+    if (slot != _lastSlot + 1) {
+        activate();
+        return;
+    }
+
+    // The previous slot is complete now
+    loadColumn(_lastSlot);
+    _lastSlot = slot;
+
+    // Clear the column of the current slot before it's used as the cursor
+    _temperatures[slot % Columns] = NoData;
+    _setpoints[slot % Columns] = NoData;
+
+    if (updateScale()) {
+        draw(slot);
+        return;
+    }
+
+    drawColumn((slot - 1) % Columns, false);
+    drawColumn(slot % Columns, true);
+}
+
+Screen::Action TrendScreen::keyPress(Keypad::Keys)
+{
+    return Action::NavigateBack;
+}
+
+void TrendScreen::rebuild(const std::time_t slot)
+{
+    _lastSlot = slot;
+
+    for (std::time_t s = slot - Columns + 1; s < slot; ++s) {
+        loadColumn(s);
+    }
+
+    _temperatures[slot % Columns] = NoData;
+    _setpoints[slot % Columns] = NoData;
+}
+
+void TrendScreen::loadColumn(const std::time_t slot)
+{
+    TemperatureHistory::Sample samples[MaxSamplesPerColumn];
+
+    const auto from = slot * ColumnSecs;
+    const auto count = _history.query(from, from + ColumnSecs - 1, samples, MaxSamplesPerColumn);
+
+    const auto column = slot % Columns;
+
+    if (count == 0) {
+        _temperatures[column] = NoData;
+        _setpoints[column] = NoData;
+        return;
+    }
+
+    int32_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += samples[i].temperature;
+    }
+
+    _temperatures[column] = sum / static_cast<int32_t>(count);
+    _setpoints[column] = samples[count - 1].setpoint;
+}
+
+bool TrendScreen::updateScale()
+{
+    int16_t min = INT16_MAX;
+    int16_t max = INT16_MIN + 1;
+
+    for (auto i = 0; i < Columns; ++i) {
+        if (_temperatures[i] != NoData) {
+            min = std::min(min, _temperatures[i]);
+            max = std::max(max, _temperatures[i]);
+        }
+        if (_setpoints[i] != NoData) {
+            min = std::min(min, _setpoints[i]);
+            max = std::max(max, _setpoints[i]);
+        }
+    }
+
+    if (min > max) {
+        min = 0;
+        max = MinScaleSpan;
+    }
+
+    // Round to whole degrees to keep the scale stable
+    min = (min - 9 * (min < 0)) / 10 * 10;
+    max = (max + 9 * (max > 0)) / 10 * 10;
+
+    if (max - min < MinScaleSpan) {
+        max = min + MinScaleSpan;
+    }
+
+    if (min == _scaleMin && max == _scaleMax) {
+        return false;
+    }
+
+    _scaleMin = min;
+    _scaleMax = max;
+
+    return true;
+}
+
+void TrendScreen::draw(const std::time_t slot)
+{
+    Display::clear();
+
+    drawTitle();
+
+    for (auto i = 0; i < Columns; ++i) {
+        drawColumn(i, i == slot % Columns);
+    }
+}
+
+void TrendScreen::drawTitle()
+{
+    // The scale is in whole degrees
+    char s[22] = "24h ";
+    auto length = 4 + Format::integer(s + 4, _scaleMin / 10);
+    s[length++] = '.';
+    s[length++] = '.';
+    length += Format::integer(s + length, _scaleMax / 10);
+    strcpy(s + length, " C");
+
+    Text::draw(s, 0, 0, 0, false);
+}
+
+void TrendScreen::drawColumn(const uint8_t column, const bool cursor)
+{
+    int8_t top = -1;
+    int8_t bottom = -1;
+    int8_t setpointY = -1;
+
+    if (!cursor && _temperatures[column] != NoData) {
+        top = bottom = valueToY(_temperatures[column]);
+
+        // Connect to the previous column, unless it's the cursor
+        const auto previous = (column + Columns - 1) % Columns;
+        if (_temperatures[previous] != NoData) {
+            const auto previousY = valueToY(_temperatures[previous]);
+            top = std::min<int8_t>(top, previousY);
+            bottom = std::max<int8_t>(bottom, previousY);
+        }
+    }
+
+    // Dotted line
+    if (!cursor && _setpoints[column] != NoData && (column & 1) == 0) {
+        setpointY = valueToY(_setpoints[column]);
+    }
+
+    for (uint8_t line = 0; line < ChartLines; ++line) {
+        const int8_t lineTop = line * 8;
+        uint8_t data = 0;
+
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            const int8_t y = lineTop + bit;
+            if ((y >= top && y <= bottom && top >= 0) || y == setpointY) {
+                data |= 1 << bit;
+            }
+        }
+
+        Display::setLine(ChartFirstLine + line);
+        Display::setColumn(column);
+        Display::sendData(data);
+    }
+}
+
+uint8_t TrendScreen::valueToY(const int16_t value) const
+{
+    const auto clamped = std::max(_scaleMin, std::min(_scaleMax, value));
+
+    return static_cast<int32_t>(_scaleMax - clamped) * (ChartHeight - 1) / (_scaleMax - _scaleMin);
+}
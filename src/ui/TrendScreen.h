@@ -0,0 +1,78 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+#pragma once
+
+#include "Keypad.h"
+#include "Screen.h"
+#include "TemperatureHistory.h"
+
+#include <cstdint>
+#include <ctime>
+
+class ISystemClock;
+
+// Line chart of the last 24 hours of temperature (solid) and set point (dotted).
+// The chart is drawn as a sweep: each column covers a fixed time interval,
+// the newest column is drawn in place and the next one is cleared as a cursor.
+class TrendScreen : public Screen
+{
+public:
+    TrendScreen(const ISystemClock& systemClock, const TemperatureHistory& history);
+
+    void activate() override;
+    void update() override;
+    Action keyPress(Keypad::Keys keys) override;
+
+private:
+    static constexpr auto Columns = 128;
+    static constexpr auto ChartFirstLine = 1;
+    static constexpr auto ChartLines = 6;
+    static constexpr auto ChartHeight = ChartLines * 8;
+    static constexpr std::time_t SpanSecs = 24 * 60 * 60;
+    static constexpr std::time_t ColumnSecs = SpanSecs / Columns;
+    static constexpr auto MaxSamplesPerColumn = ColumnSecs / TemperatureHistory::SampleIntervalSecs + 1;
+    static constexpr int16_t NoData = INT16_MIN;
+
+    // Minimum span of the vertical scale in 0.1 Celsius
+    static constexpr int16_t MinScaleSpan = 20;
+
+    const ISystemClock& _systemClock;
+    const TemperatureHistory& _history;
+
+    // Column values in 0.1 Celsius, indexed by slot modulo Columns
+    int16_t _temperatures[Columns];
+    int16_t _setpoints[Columns];
+
+    std::time_t _lastSlot = 0;
+    int16_t _scaleMin = 0;
+    int16_t _scaleMax = 0;
+
+    void rebuild(std::time_t slot);
+    void loadColumn(std::time_t slot);
+    bool updateScale();
+
+    void draw(std::time_t slot);
+    void drawTitle();
+    void drawColumn(uint8_t column, bool cursor);
+
+    uint8_t valueToY(int16_t value) const;
+};
@@ -18,21 +18,20 @@
     Created on 2017-01-07
 */
 
-#include "ui.h"
+#include "Ui.h"
 #include "Settings.h"
 #include "SystemClock.h"
 #include "TemperatureSensor.h"
-#include "main.h"
+#include "TraceRecorder.h"
 
 #include "display/Display.h"
 
 #include "MainScreen.h"
 #include "MenuScreen.h"
 #include "SchedulingScreen.h"
+#include "TrendScreen.h"
 
-#include <algorithm>
-#include <iostream>
-#include <string.h>
+#include <new>
 #include <stdio.h>
 
 // #define ENABLE_DEBUG
@@ -43,40 +42,47 @@ Ui::Ui(
     const ISystemClock& systemClock,
     Keypad& keypad,
     HeatingController& heatingController,
-    const TemperatureSensor& temperatureSensor
+    const TemperatureSensor& temperatureSensor,
+    const TemperatureHistory& temperatureHistory
 )
     : _settings(settings)
     , _systemClock(systemClock)
     , _keypad(keypad)
     , _heatingController(heatingController)
     , _temperatureSensor(temperatureSensor)
+    , _temperatureHistory(temperatureHistory)
+    , _mainScreen(_settings, _systemClock, _heatingController, _temperatureSensor)
 {
     _log.info_P(PSTR("initializing Display, brightness: %d"), _settings.data.Display.Brightness);
     Display::init();
-    Display::setContrast(_settings.data.Display.Brightness);
+    _animator.setContrast(_settings.data.Display.Brightness);
 
-    auto mainScreen = std::unique_ptr<MainScreen>(new MainScreen(_settings, _systemClock, _heatingController, _temperatureSensor));
-    _mainScreen = mainScreen.get();
-    _currentScreen = _mainScreen;
-    mainScreen->activate();
-    _screens.push_back(std::move(mainScreen));
-
-    _screens.emplace_back(new MenuScreen(_settings));
-    _screens.emplace_back(new SchedulingScreen(_settings, _systemClock));
+    _currentScreen = &_mainScreen;
+    _mainScreen.activate();
 
     _lastKeyPressTime = _systemClock.utcTime();
 }
 
 void Ui::task()
 {
-    const auto pressedKeys = _keypad.scan();
-    handleKeyPress(pressedKeys);
+    _keypad.scan();
+
+    Keypad::KeyEvent event;
+    while (_keypad.takeEvent(event)) {
+        TraceRecorder::recordKeyEvent(event);
+        handleKeyPress(event);
+    }
+
+    _animator.task();
 }
 
 void Ui::update()
 {
     if (_currentScreen) {
+        // Unchanged values are not sent again
+        Display::beginFrame();
         _currentScreen->update();
+        Display::endFrame();
     } else {
         _log.warning_P(PSTR("update: current screen is null"));
     }
@@ -95,11 +101,14 @@ void Ui::handleKeyPress(const Keypad::Keys keys)
 
     // If the display is sleeping, use this keypress to wake it up,
     // but don't interact with the UI while it's invisible.
-    if (!Display::isPoweredOn()) {
+    if (!Display::isPoweredOn() || _animator.isFadingOut()) {
         _log.info_P(PSTR("display is off, ignoring key press"));
+        updateActiveState();
         return;
     }
 
+    Display::beginFrame();
+
     const auto action = _currentScreen->keyPress(keys);
     bool screenChanged = true;
 
@@ -118,27 +127,57 @@ void Ui::handleKeyPress(const Keypad::Keys keys)
     }
 
     if (screenChanged) {
-        Display::clear();
-        _currentScreen->activate();
+        redraw();
+    }
+
+    Display::endFrame();
+}
+
+void Ui::handleKeyPress(const Keypad::KeyEvent& event)
+{
+    switch (event.type) {
+        case Keypad::KeyEvent::Type::Press:
+            handleKeyPress(event.key);
+            break;
+
+        case Keypad::KeyEvent::Type::LongPress:
+        case Keypad::KeyEvent::Type::Repeat:
+            handleKeyPress(event.key | Keypad::Keys::LongPress);
+            break;
+
+        case Keypad::KeyEvent::Type::Release:
+            // Keep the display on while a key is held
+            _lastKeyPressTime = _systemClock.utcTime();
+            break;
     }
 }
 
 void Ui::updateActiveState()
 {
     if (isActive()) {
-        if (!Display::isPoweredOn()) {
+        if (!Display::isPoweredOn() || _animator.isFadingOut()) {
             _log.debug_P(PSTR("powering on the display, brightness: %d"), _settings.data.Display.Brightness);
-            Display::powerOn();
-            Display::setContrast(_settings.data.Display.Brightness);
+            _animator.fadeIn(_settings.data.Display.Brightness);
         }
     } else {
-        if (Display::isPoweredOn()) {
+        if (Display::isPoweredOn() && !_animator.isFadingOut()) {
             _log.debug_P(PSTR("powering off the display"));
-            Display::powerOff();
+            _animator.fadeOut();
         }
     }
 }
 
+void Ui::redraw()
+{
+    // Drawing in a frame, only the difference to the old screen is sent
+    // and the slide starts after that
+    Display::beginFrame();
+    Display::clear();
+    _currentScreen->activate();
+    _animator.rollIn();
+    Display::endFrame();
+}
+
 bool Ui::isActive() const
 {
     if (_settings.data.Display.TimeoutSecs == 0) {
@@ -148,41 +187,65 @@ bool Ui::isActive() const
     return (_systemClock.utcTime() - _lastKeyPressTime) < static_cast<std::time_t>(_settings.data.Display.TimeoutSecs);
 }
 
-void Ui::navigateForward(const char* name)
+void Ui::navigateForward(const ScreenId id)
 {
-    if (!name) {
-        _log.warning_P(PSTR("navigating forward, screen name is null, going to main screen"));
-        _currentScreen = _mainScreen;
+    if (id == ScreenId::Main) {
+        navigateBackward();
         return;
     }
 
-    _log.debug_P(PSTR("navigating forward, next screen: %s"), name);
+    if (_arenaScreen && _arenaScreen->id() == id) {
+        _currentScreen = _arenaScreen;
+        return;
+    }
 
-    const auto it = std::find_if(std::begin(_screens), std::end(_screens), [name](const std::unique_ptr<Screen>& scr) {
-        return strcmp(scr->name(), name) == 0;
-    });
+    releaseScreen();
 
-    if (it == std::end(_screens)) {
-        _log.warning_P(PSTR("screen not found: %s, going to main screen"));
-        _currentScreen = _mainScreen;
+    _arenaScreen = createScreen(id);
+
+    if (!_arenaScreen) {
+        _log.warning_P(PSTR("unknown screen: %d, going to main screen"), static_cast<int>(id));
+        _currentScreen = &_mainScreen;
         return;
     }
 
-    _currentScreen = it->get();
+    _log.debug_P(PSTR("navigating forward, next screen: %s"), _arenaScreen->name());
+
+    _currentScreen = _arenaScreen;
 }
 
 void Ui::navigateBackward()
 {
-    _log.debug_P(PSTR("navigating back"));
+    _log.debug_P(PSTR("navigating back to main screen"));
 
-    if (_screenStack.empty()) {
-        _log.debug_P(PSTR("screen stack is empty, navigating to main screen"));
-        _currentScreen = _mainScreen;
-        return;
+    _currentScreen = &_mainScreen;
+
+    releaseScreen();
+}
+
+Screen* Ui::createScreen(const ScreenId id)
+{
+    switch (id) {
+        case ScreenId::Menu:
+            return new (_screenArena) MenuScreen(_settings);
+
+        case ScreenId::Scheduling:
+            return new (_screenArena) SchedulingScreen(_settings, _systemClock);
+
+        case ScreenId::Trend:
+            return new (_screenArena) TrendScreen(_systemClock, _temperatureHistory);
+
+        default:
+            return nullptr;
     }
+}
 
-    _currentScreen = _screenStack.top();
-    _screenStack.pop();
+void Ui::releaseScreen()
+{
+    if (!_arenaScreen) {
+        return;
+    }
 
-    _log.debug_P(PSTR("current screen: %s"), _currentScreen->name());
+    _arenaScreen->~Screen();
+    _arenaScreen = nullptr;
 }
@@ -24,17 +24,19 @@
 #include "Keypad.h"
 #include "Logger.h"
 
+#include "DisplayAnimator.h"
 #include "Screen.h"
 #include "MainScreen.h"
 #include "MenuScreen.h"
 #include "SchedulingScreen.h"
+#include "TrendScreen.h"
 
+#include <algorithm>
 #include <ctime>
-#include <memory>
-#include <stack>
 
 class ISystemClock;
 class Settings;
+class TemperatureHistory;
 class TemperatureSensor;
 
 class Ui
@@ -45,13 +47,17 @@ public:
         const ISystemClock& systemClock,
         Keypad& keypad,
         HeatingController& heatingController,
-        const TemperatureSensor& temperatureSensor
+        const TemperatureSensor& temperatureSensor,
+        const TemperatureHistory& temperatureHistory
     );
 
     void task();
 
     void update();
     void handleKeyPress(Keypad::Keys keys);
+    void handleKeyPress(const Keypad::KeyEvent& event);
+
+    bool isActive() const;
 
 private:
     Settings& _settings;
@@ -59,18 +65,39 @@ private:
     Keypad& _keypad;
     HeatingController& _heatingController;
     const TemperatureSensor& _temperatureSensor;
+    const TemperatureHistory& _temperatureHistory;
     Logger _log{ "Ui" };
     std::time_t _lastKeyPressTime = 0;
+    DisplayAnimator _animator;
+
+    // The main screen is always resident, the others are constructed
+    // on demand in the arena and destroyed when returning to the main screen
+    MainScreen _mainScreen;
+
+    static constexpr auto ScreenArenaSize = std::max({
+        sizeof(MenuScreen),
+        sizeof(SchedulingScreen),
+        sizeof(TrendScreen)
+    });
 
-    std::stack<Screen*> _screenStack;
-    std::vector<std::unique_ptr<Screen>> _screens;
+    static constexpr auto ScreenArenaAlignment = std::max({
+        alignof(MenuScreen),
+        alignof(SchedulingScreen),
+        alignof(TrendScreen)
+    });
+
+    alignas(ScreenArenaAlignment) uint8_t _screenArena[ScreenArenaSize];
+    Screen* _arenaScreen = nullptr;
 
     Screen* _currentScreen = nullptr;
-    Screen* _mainScreen = nullptr;
 
     void updateActiveState();
-    bool isActive() const;
 
-    void navigateForward(const char* name);
+    void redraw();
+
+    void navigateForward(ScreenId id);
     void navigateBackward();
+
+    Screen* createScreen(ScreenId id);
+    void releaseScreen();
 };
@@ -0,0 +1,171 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// Bitmap: the ASCII-art conversion, the PackBits encoder and the Reader
+// decoding it in pieces of any length.
+
+#include "display/Bitmap.h"
+
+#include <unity.h>
+
+#include <vector>
+
+namespace
+{
+    constexpr auto Arrow = Bitmap::fromAscii(
+        "..#..",
+        ".###.",
+        "#####",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        ".....",
+        "#####"
+    );
+
+    constexpr auto ArrowPacked = Bitmap::pack<Bitmap::packedSize(Arrow)>(Arrow);
+
+    std::vector<uint8_t> pack(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> packed(Bitmap::Detail::packBits(data.data(), data.size(), nullptr));
+        TEST_ASSERT_EQUAL_size_t(packed.size(), Bitmap::Detail::packBits(data.data(), data.size(), packed.data()));
+        return packed;
+    }
+
+    // Decodes the data in pieces of pieceLength bytes
+    std::vector<uint8_t> unpack(const std::vector<uint8_t>& packed, const std::size_t length, const std::size_t pieceLength)
+    {
+        std::vector<uint8_t> data(length);
+        Bitmap::Reader reader({ packed.data(), 0, 0, Bitmap::Encoding::PackBits });
+
+        for (std::size_t offset = 0; offset < length; offset += pieceLength) {
+            reader.read(data.data() + offset, std::min(pieceLength, length - offset));
+        }
+
+        return data;
+    }
+
+    void checkRoundTrip(const std::vector<uint8_t>& data)
+    {
+        const auto packed = pack(data);
+
+        for (const std::size_t pieceLength : { 1, 3, 7, 128, 1000 }) {
+            const auto unpacked = unpack(packed, data.size(), pieceLength);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(data.data(), unpacked.data(), data.size());
+        }
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_from_ascii_page_layout()
+{
+    static_assert(Arrow.width == 5 && Arrow.pages == 2, "Arrow should be 5 columns of 2 pages");
+
+    // The top row is the least significant bit of the first page
+    const uint8_t expected[] = {
+        0b100, 0b110, 0b111, 0b110, 0b100,
+        0b1, 0b1, 0b1, 0b1, 0b1
+    };
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, Arrow.data, sizeof(expected));
+}
+
+void test_pack_bits_encoding()
+{
+    // A literal run up to the next run of three, then a repeated byte
+    const std::vector<uint8_t> data = { 1, 2, 3, 3, 3, 3, 4 };
+    const std::vector<uint8_t> expected = { 1, 1, 2, 253, 3, 0, 4 };
+
+    const auto packed = pack(data);
+
+    TEST_ASSERT_EQUAL_size_t(expected.size(), packed.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), packed.data(), expected.size());
+}
+
+void test_long_runs_are_split()
+{
+    // 128 repeats and 128 literals at most in one run
+    checkRoundTrip(std::vector<uint8_t>(300, 0xAA));
+
+    std::vector<uint8_t> literals(300);
+    for (std::size_t i = 0; i < literals.size(); ++i) {
+        literals[i] = static_cast<uint8_t>(i);
+    }
+
+    checkRoundTrip(literals);
+
+    TEST_ASSERT_EQUAL_size_t(6, pack(std::vector<uint8_t>(300, 0xAA)).size());
+    TEST_ASSERT_EQUAL_size_t(300 + 3, pack(literals).size());
+}
+
+void test_mixed_data_round_trip()
+{
+    std::vector<uint8_t> data;
+
+    for (auto i = 0; i < 40; ++i) {
+        data.insert(data.end(), i % 5, static_cast<uint8_t>(i));
+        data.push_back(static_cast<uint8_t>(0xF0 | i));
+    }
+
+    checkRoundTrip(data);
+    checkRoundTrip({ 42 });
+    checkRoundTrip({ 7, 7 });
+}
+
+void test_reader_of_packed_image()
+{
+    static_assert(sizeof(ArrowPacked.data) < sizeof(Arrow.data), "The arrow should compress");
+
+    uint8_t raw[Arrow.size];
+    uint8_t unpacked[Arrow.size];
+
+    Bitmap::Reader rawReader(Bitmap::image(Arrow));
+    rawReader.read(raw, 3);
+    rawReader.read(raw + 3, Arrow.size - 3);
+
+    Bitmap::Reader packedReader(Bitmap::image(ArrowPacked));
+    packedReader.read(unpacked, 4);
+    packedReader.read(unpacked + 4, Arrow.size - 4);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Arrow.data, raw, Arrow.size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Arrow.data, unpacked, Arrow.size);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_from_ascii_page_layout);
+    RUN_TEST(test_pack_bits_encoding);
+    RUN_TEST(test_long_runs_are_split);
+    RUN_TEST(test_mixed_data_round_trip);
+    RUN_TEST(test_reader_of_packed_image);
+
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// MqttStateDocument: the longest document fits in the buffer untruncated,
+// and only changed states are serialized.
+
+#include "MqttStateDocument.h"
+
+#include <unity.h>
+
+#include <cstring>
+
+namespace
+{
+    MqttStateDocument::State longestState()
+    {
+        MqttStateDocument::State state;
+        state.currentTemp = INT16_MIN;
+        state.activeTemp = INT16_MIN;
+        state.daytimeTemp = INT16_MIN;
+        state.nightTimeTemp = INT16_MIN;
+        state.mode = UINT8_MAX;
+        state.boostRemainingMins = UINT16_MAX;
+        state.nextTransitionState = UINT8_MAX;
+        state.nextTransitionWeekday = UINT8_MAX;
+        state.nextTransitionHour = UINT8_MAX;
+        state.nextTransitionMinute = UINT8_MAX;
+        return state;
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_longest_document_fits()
+{
+    MqttStateDocument document;
+
+    TEST_ASSERT_TRUE(document.update(longestState()));
+
+    TEST_ASSERT_EQUAL_STRING(
+        R"({"current":-3276.8,"active":-3276.8,"daytime":-3276.8,"nightTime":-3276.8)"
+        R"(,"mode":255,"boost":false,"boostRemainingMins":65535,"heating":false)"
+        R"(,"next":{"state":255,"weekday":255,"hour":255,"minute":255}})",
+        document.json()
+    );
+    TEST_ASSERT_EQUAL_size_t(MqttStateDocument::MaxLength, document.length());
+    TEST_ASSERT_EQUAL_size_t(strlen(document.json()), document.length());
+}
+
+void test_unchanged_state_is_not_serialized()
+{
+    MqttStateDocument document;
+    MqttStateDocument::State state;
+    state.currentTemp = 215;
+    state.boostActive = true;
+
+    TEST_ASSERT_TRUE(document.update(state));
+    TEST_ASSERT_FALSE(document.update(state));
+
+    document.invalidate();
+    TEST_ASSERT_TRUE(document.update(state));
+
+    state.heatingActive = true;
+    TEST_ASSERT_TRUE(document.update(state));
+    TEST_ASSERT_NOT_NULL(strstr(document.json(), R"("current":21.5)"));
+    TEST_ASSERT_NOT_NULL(strstr(document.json(), R"("boost":true)"));
+    TEST_ASSERT_NOT_NULL(strstr(document.json(), R"("heating":true)"));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_longest_document_fits);
+    RUN_TEST(test_unchanged_state_is_not_serialized);
+
+    return UNITY_END();
+}
@@ -0,0 +1,262 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// Settings field table: every field is clamped to its limits, rolls over
+// when adjusted, and is reset by the checks of load() and save().
+
+#include "Settings.h"
+#include "native/MemorySettingsHandler.h"
+
+#include <unity.h>
+
+#include <climits>
+#include <cstdio>
+
+namespace
+{
+    using Field = Settings::Field;
+    using Type = Settings::FieldDescriptor::Type;
+
+    // Values that don't match any default, to see the reset
+    constexpr uint8_t CustomBrightness = 99;
+    constexpr uint8_t CustomTimeoutSecs = 42;
+
+    MemorySettingsHandler* handler = nullptr;
+    Settings* settings = nullptr;
+
+    int32_t typeMin(const Type type)
+    {
+        switch (type) {
+            case Type::UInt8: return 0;
+            case Type::Int8: return INT8_MIN;
+            case Type::UInt16: return 0;
+            case Type::Int16: return INT16_MIN;
+        }
+
+        return 0;
+    }
+
+    // Settings::fieldValue() reads 16 bit unsigned fields saturated to INT16_MAX
+    int32_t typeMax(const Type type)
+    {
+        switch (type) {
+            case Type::UInt8: return UINT8_MAX;
+            case Type::Int8: return INT8_MAX;
+            case Type::UInt16: return INT16_MAX;
+            case Type::Int16: return INT16_MAX;
+        }
+
+        return 0;
+    }
+
+    const char* fieldName(const Field field)
+    {
+        static char name[16];
+        snprintf(name, sizeof(name), "field %u", static_cast<unsigned>(field));
+        return name;
+    }
+
+    // Stores the data as is, bypassing the checks of Settings::save()
+    void storeRaw(const Settings::Data& data)
+    {
+        settings->data = data;
+        handler->save();
+    }
+
+    Settings::Data customData()
+    {
+        Settings::Data data{};
+        data.Display.Brightness = CustomBrightness;
+        data.Display.TimeoutSecs = CustomTimeoutSecs;
+        return data;
+    }
+
+    // Checks a value that load() and save() must replace by the field's default
+    void checkReset(const Settings::FieldDescriptor& desc, const int32_t value)
+    {
+        auto data = customData();
+        Settings::setFieldValue(data, desc.field, static_cast<int16_t>(value));
+
+        // Loaded
+        storeRaw(data);
+        settings->load();
+
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.defaultValue, Settings::fieldValue(settings->data, desc.field), fieldName(desc.field));
+
+        // A correction means corrupted data, the unchecked display settings are reset too
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(DefaultSettings::Display::Brightness, settings->data.Display.Brightness, fieldName(desc.field));
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(DefaultSettings::Display::TimeoutSecs, settings->data.Display.TimeoutSecs, fieldName(desc.field));
+
+        // The corrected data is saved right away
+        settings->data = customData();
+        handler->load();
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.defaultValue, Settings::fieldValue(settings->data, desc.field), fieldName(desc.field));
+
+        // Saved
+        settings->data = data;
+        settings->save();
+
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.defaultValue, Settings::fieldValue(settings->data, desc.field), fieldName(desc.field));
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(DefaultSettings::Display::Brightness, settings->data.Display.Brightness, fieldName(desc.field));
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(DefaultSettings::Display::TimeoutSecs, settings->data.Display.TimeoutSecs, fieldName(desc.field));
+    }
+}
+
+void setUp()
+{
+    handler = new MemorySettingsHandler;
+    settings = new Settings{ *handler };
+}
+
+void tearDown()
+{
+    delete settings;
+    delete handler;
+}
+
+void test_clamp_below_min()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.min, Settings::clampFieldValue(desc.field, desc.min - 1), fieldName(desc.field));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.min, Settings::clampFieldValue(desc.field, INT32_MIN), fieldName(desc.field));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.min, Settings::clampFieldValue(desc.field, desc.min), fieldName(desc.field));
+    }
+}
+
+void test_clamp_above_max()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.max, Settings::clampFieldValue(desc.field, desc.max + 1), fieldName(desc.field));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.max, Settings::clampFieldValue(desc.field, INT32_MAX), fieldName(desc.field));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.max, Settings::clampFieldValue(desc.field, desc.max), fieldName(desc.field));
+    }
+}
+
+void test_adjust_rolls_over()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        Settings::Data data{};
+
+        Settings::setFieldValue(data, desc.field, desc.max);
+        Settings::adjustFieldValue(data, desc.field, 1);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.min, Settings::fieldValue(data, desc.field), fieldName(desc.field));
+
+        Settings::adjustFieldValue(data, desc.field, -1);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.max, Settings::fieldValue(data, desc.field), fieldName(desc.field));
+
+        Settings::setFieldValue(data, desc.field, desc.min);
+        Settings::adjustFieldValue(data, desc.field, 1);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(desc.min + 1, Settings::fieldValue(data, desc.field), fieldName(desc.field));
+    }
+}
+
+void test_check_keeps_valid_values()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        for (const auto value : { desc.min, desc.max }) {
+            auto data = customData();
+            Settings::setFieldValue(data, desc.field, value);
+
+            storeRaw(data);
+            settings->load();
+
+            TEST_ASSERT_EQUAL_INT_MESSAGE(value, Settings::fieldValue(settings->data, desc.field), fieldName(desc.field));
+            TEST_ASSERT_EQUAL_UINT_MESSAGE(desc.field == Field::DisplayBrightness ? value : CustomBrightness, settings->data.Display.Brightness, fieldName(desc.field));
+            TEST_ASSERT_EQUAL_UINT_MESSAGE(desc.field == Field::DisplayTimeoutSecs ? value : CustomTimeoutSecs, settings->data.Display.TimeoutSecs, fieldName(desc.field));
+        }
+    }
+}
+
+void test_check_resets_below_min()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        if (desc.min > typeMin(desc.type)) {
+            checkReset(desc, desc.min - 1);
+            checkReset(desc, typeMin(desc.type));
+        }
+    }
+}
+
+void test_check_resets_above_max()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        if (desc.max < typeMax(desc.type)) {
+            checkReset(desc, desc.max + 1);
+            checkReset(desc, typeMax(desc.type));
+        }
+    }
+}
+
+// Only the display settings have no invalid values, which is why they're
+// reset along with any corrected field
+void test_only_display_fields_are_unchecked()
+{
+    for (const auto& desc : SettingsFields::Table) {
+        const auto checked = desc.min > typeMin(desc.type) || desc.max < typeMax(desc.type);
+        const auto display = desc.field == Field::DisplayBrightness || desc.field == Field::DisplayTimeoutSecs;
+
+        TEST_ASSERT_TRUE_MESSAGE(checked != display, fieldName(desc.field));
+    }
+}
+
+void test_corrupted_mode_falls_back_to_off()
+{
+    TEST_ASSERT_EQUAL_INT(DefaultSettings::HeatingController::FallbackMode, Settings::descriptor(Field::HeatingControllerMode).defaultValue);
+
+    auto data = customData();
+    data.HeatingController.Mode = 0xff;
+
+    storeRaw(data);
+    settings->load();
+
+    TEST_ASSERT_EQUAL_UINT(DefaultSettings::HeatingController::FallbackMode, settings->data.HeatingController.Mode);
+}
+
+void test_defaults_are_valid()
+{
+    settings->data = customData();
+    settings->loadDefaults();
+
+    for (const auto& desc : SettingsFields::Table) {
+        const auto value = Settings::fieldValue(settings->data, desc.field);
+        TEST_ASSERT_TRUE_MESSAGE(value >= desc.min && value <= desc.max, fieldName(desc.field));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(DefaultSettings::Display::Brightness, settings->data.Display.Brightness);
+    TEST_ASSERT_EQUAL_UINT(DefaultSettings::Display::TimeoutSecs, settings->data.Display.TimeoutSecs);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_clamp_below_min);
+    RUN_TEST(test_clamp_above_max);
+    RUN_TEST(test_adjust_rolls_over);
+    RUN_TEST(test_check_keeps_valid_values);
+    RUN_TEST(test_check_resets_below_min);
+    RUN_TEST(test_check_resets_above_max);
+    RUN_TEST(test_only_display_fields_are_unchecked);
+    RUN_TEST(test_corrupted_mode_falls_back_to_off);
+    RUN_TEST(test_defaults_are_valid);
+
+    return UNITY_END();
+}
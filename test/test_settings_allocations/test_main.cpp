@@ -0,0 +1,109 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// Settings::load() and save() don't allocate from the heap, including the
+// formatting of the debug dump.
+
+#include "Settings.h"
+#include "native/MemorySettingsHandler.h"
+
+#include <unity.h>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::size_t allocations = 0;
+}
+
+void* operator new(const std::size_t size)
+{
+    ++allocations;
+
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* const p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void setUp()
+{
+    // The debug dump is only formatted when it's printed
+    Logger::verbose = true;
+}
+
+void tearDown()
+{
+    Logger::verbose = false;
+}
+
+void test_load_and_save_dont_allocate()
+{
+    MemorySettingsHandler handler;
+    Settings settings{ handler };
+
+    // The handler allocates its storage on the first save
+    settings.save();
+
+    allocations = 0;
+
+    settings.load();
+    settings.save();
+
+    TEST_ASSERT_EQUAL_size_t(0, allocations);
+}
+
+void test_corrected_load_doesnt_allocate()
+{
+    MemorySettingsHandler handler;
+    Settings settings{ handler };
+
+    settings.data.HeatingController.Mode = 0xff;
+    handler.save();
+
+    allocations = 0;
+
+    settings.load();
+
+    TEST_ASSERT_EQUAL_size_t(0, allocations);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_load_and_save_dont_allocate);
+    RUN_TEST(test_corrected_load_doesnt_allocate);
+
+    return UNITY_END();
+}
@@ -0,0 +1,140 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// SpscQueue: FIFO order, rejecting pushes when full, and the wrap-around of
+// the 8-bit indices.
+
+#include "SpscQueue.h"
+
+#include <unity.h>
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_items_are_popped_in_order()
+{
+    SpscQueue<uint16_t, 8> queue;
+    uint16_t item = 0;
+
+    TEST_ASSERT_TRUE(queue.isEmpty());
+    TEST_ASSERT_FALSE(queue.pop(item));
+
+    for (uint16_t i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(queue.push(1000 + i));
+    }
+
+    TEST_ASSERT_FALSE(queue.isEmpty());
+
+    for (uint16_t i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(queue.pop(item));
+        TEST_ASSERT_EQUAL_UINT(1000 + i, item);
+    }
+
+    TEST_ASSERT_TRUE(queue.isEmpty());
+    TEST_ASSERT_FALSE(queue.pop(item));
+}
+
+void test_full_queue_rejects_push()
+{
+    SpscQueue<uint8_t, 4> queue;
+    uint8_t item = 0;
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        TEST_ASSERT_TRUE(queue.push(i));
+    }
+
+    // The rejected item doesn't overwrite the oldest one
+    TEST_ASSERT_FALSE(queue.push(99));
+
+    TEST_ASSERT_TRUE(queue.pop(item));
+    TEST_ASSERT_EQUAL_UINT8(0, item);
+
+    TEST_ASSERT_TRUE(queue.push(4));
+    TEST_ASSERT_FALSE(queue.push(99));
+
+    for (uint8_t i = 1; i <= 4; ++i) {
+        TEST_ASSERT_TRUE(queue.pop(item));
+        TEST_ASSERT_EQUAL_UINT8(i, item);
+    }
+
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_indices_wrap_around()
+{
+    SpscQueue<uint32_t, 4> queue;
+    uint32_t item = 0;
+    uint32_t next = 0;
+
+    // Well past the 8-bit range, with the queue full at each wrap of the indices
+    for (uint32_t i = 0; i < 1000; ++i) {
+        TEST_ASSERT_TRUE(queue.push(i));
+
+        if (i % 4 == 3) {
+            TEST_ASSERT_FALSE(queue.push(UINT32_MAX));
+
+            while (queue.pop(item)) {
+                TEST_ASSERT_EQUAL_UINT32(next++, item);
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1000, next);
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_largest_queue()
+{
+    SpscQueue<uint8_t, 128> queue;
+    uint8_t item = 0;
+
+    for (auto round = 0; round < 3; ++round) {
+        for (auto i = 0; i < 128; ++i) {
+            TEST_ASSERT_TRUE(queue.push(static_cast<uint8_t>(i)));
+        }
+
+        TEST_ASSERT_FALSE(queue.push(0));
+
+        for (auto i = 0; i < 128; ++i) {
+            TEST_ASSERT_TRUE(queue.pop(item));
+            TEST_ASSERT_EQUAL_UINT8(i, item);
+        }
+
+        TEST_ASSERT_TRUE(queue.isEmpty());
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_items_are_popped_in_order);
+    RUN_TEST(test_full_queue_rejects_push);
+    RUN_TEST(test_indices_wrap_around);
+    RUN_TEST(test_largest_queue);
+
+    return UNITY_END();
+}
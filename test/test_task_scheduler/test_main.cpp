@@ -0,0 +1,237 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// TaskScheduler on the emulated clock: wrapping the wheel, intervals longer
+// than the wheel span, rescheduling pending jobs, the wrap-around of millis()
+// and the time until the next job.
+
+#include "TaskScheduler.h"
+
+#include "hal/Time.h"
+#include "hal/native/Native.h"
+
+#include <unity.h>
+
+#include <vector>
+
+namespace
+{
+    // The time covered by one turn of the wheel
+    constexpr uint32_t WheelSpanMs = TaskScheduler::SlotCount * TaskScheduler::TickMs;
+
+    TaskScheduler* scheduler = nullptr;
+    std::vector<uint32_t>* runs = nullptr;
+
+    TaskScheduler::Job recordRun()
+    {
+        return [] {
+            runs->push_back(Hal::Time::millis());
+        };
+    }
+
+    // Runs the scheduler every stepMs until the time is reached
+    void runUntil(const uint32_t ms, const uint32_t stepMs = TaskScheduler::TickMs)
+    {
+        while (Hal::Time::millis() < ms) {
+            Hal::Native::advanceMillis(stepMs);
+            scheduler->run(Hal::Time::millis());
+        }
+    }
+}
+
+void setUp()
+{
+    Hal::Native::reset();
+    scheduler = new TaskScheduler;
+    runs = new std::vector<uint32_t>;
+
+    scheduler->run(Hal::Time::millis());
+}
+
+void tearDown()
+{
+    delete runs;
+    delete scheduler;
+}
+
+void test_periodic_job_wraps_the_wheel()
+{
+    scheduler->schedulePeriodic(50, recordRun());
+
+    // Three turns of the wheel and more
+    runUntil(3 * WheelSpanMs + 100);
+
+    TEST_ASSERT_EQUAL_size_t((3 * WheelSpanMs + 100) / 50, runs->size());
+
+    for (std::size_t i = 0; i < runs->size(); ++i) {
+        TEST_ASSERT_EQUAL_UINT32((i + 1) * 50, (*runs)[i]);
+    }
+}
+
+void test_interval_longer_than_wheel_span()
+{
+    static_assert(1000 > WheelSpanMs, "The interval must exceed the wheel span");
+
+    scheduler->schedulePeriodic(1000, recordRun());
+
+    // Passing the job's slot on the earlier turns doesn't run it
+    runUntil(2500);
+
+    TEST_ASSERT_EQUAL_size_t(2, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(1000, (*runs)[0]);
+    TEST_ASSERT_EQUAL_UINT32(2000, (*runs)[1]);
+}
+
+void test_late_run_skips_missed_runs()
+{
+    scheduler->schedulePeriodic(1000, recordRun());
+
+    // Jumps over whole turns of the wheel
+    runUntil(2800, 700);
+
+    TEST_ASSERT_EQUAL_size_t(2, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(1400, (*runs)[0]);
+    TEST_ASSERT_EQUAL_UINT32(2100, (*runs)[1]);
+
+    runs->clear();
+    scheduler->schedulePeriodic(10, recordRun());
+    runUntil(2900, 100);
+
+    // One run of the short job, not a burst of the missed ones
+    TEST_ASSERT_EQUAL_size_t(1, runs->size());
+}
+
+void test_one_shot_job_runs_once()
+{
+    scheduler->scheduleOnce(30, recordRun());
+
+    runUntil(WheelSpanMs + 100);
+
+    TEST_ASSERT_EQUAL_size_t(1, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(30, (*runs)[0]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, scheduler->msUntilNextJob());
+}
+
+void test_set_interval_reschedules_pending_job()
+{
+    const auto id = scheduler->schedulePeriodic(1000, recordRun());
+
+    runUntil(500);
+    scheduler->setInterval(id, 100);
+    runUntil(800);
+
+    TEST_ASSERT_EQUAL_size_t(3, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(600, (*runs)[0]);
+    TEST_ASSERT_EQUAL_UINT32(700, (*runs)[1]);
+    TEST_ASSERT_EQUAL_UINT32(800, (*runs)[2]);
+
+    // The same interval keeps the schedule
+    runUntil(850);
+    scheduler->setInterval(id, 100);
+    runUntil(900);
+
+    TEST_ASSERT_EQUAL_size_t(4, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(900, (*runs)[3]);
+
+    // Back to a longer interval than the wheel span
+    scheduler->setInterval(id, 1000);
+    runUntil(2000);
+
+    TEST_ASSERT_EQUAL_size_t(5, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(1900, (*runs)[4]);
+}
+
+void test_cancelled_job_doesnt_run()
+{
+    const auto id = scheduler->schedulePeriodic(100, recordRun());
+
+    runUntil(50);
+    scheduler->cancel(id);
+    runUntil(500);
+
+    TEST_ASSERT_EQUAL_size_t(0, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, scheduler->msUntilNextJob());
+}
+
+void test_ms_until_next_job()
+{
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, scheduler->msUntilNextJob());
+
+    scheduler->schedulePeriodic(100, recordRun());
+    scheduler->scheduleOnce(30, recordRun());
+
+    TEST_ASSERT_EQUAL_UINT32(30, scheduler->msUntilNextJob());
+
+    runUntil(30);
+
+    TEST_ASSERT_EQUAL_size_t(1, runs->size());
+    TEST_ASSERT_EQUAL_UINT32(70, scheduler->msUntilNextJob());
+
+    // Between two ticks the time since the last one counts too
+    Hal::Native::advanceMillis(2);
+
+    TEST_ASSERT_EQUAL_UINT32(68, scheduler->msUntilNextJob());
+
+    // An overdue job is due right away
+    Hal::Native::advanceMillis(200);
+
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler->msUntilNextJob());
+}
+
+void test_millis_wrap_around()
+{
+    TaskScheduler wrapping;
+    std::vector<uint32_t> timestamps;
+
+    auto timestamp = UINT32_MAX - 12;
+    wrapping.run(timestamp);
+
+    wrapping.schedulePeriodic(20, [&timestamps, &timestamp] {
+        timestamps.push_back(timestamp);
+    });
+
+    for (auto i = 0; i < 20; ++i) {
+        timestamp += TaskScheduler::TickMs;
+        wrapping.run(timestamp);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(5, timestamps.size());
+
+    for (std::size_t i = 0; i < timestamps.size(); ++i) {
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(UINT32_MAX - 12 + (i + 1) * 20), timestamps[i]);
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_periodic_job_wraps_the_wheel);
+    RUN_TEST(test_interval_longer_than_wheel_span);
+    RUN_TEST(test_late_run_skips_missed_runs);
+    RUN_TEST(test_one_shot_job_runs_once);
+    RUN_TEST(test_set_interval_reschedules_pending_job);
+    RUN_TEST(test_cancelled_job_doesnt_run);
+    RUN_TEST(test_ms_until_next_job);
+    RUN_TEST(test_millis_wrap_around);
+
+    return UNITY_END();
+}
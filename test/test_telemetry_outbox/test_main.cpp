@@ -0,0 +1,268 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// TelemetryOutbox against a mock broker: overflow, paced draining, keeping
+// the batches that failed to publish, the batch JSON, and ignoring the
+// samples taken before the clock was synchronized.
+
+#include "Extras.h"
+#include "TelemetryOutbox.h"
+
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Collects the published payloads, or rejects them like a broken connection
+    struct MockBroker
+    {
+        bool accept = true;
+        std::vector<std::string> messages;
+        std::size_t rejected = 0;
+
+        TelemetryOutbox::PublishFunction publisher()
+        {
+            return [this](const char* payload, const std::size_t length) {
+                if (!accept) {
+                    ++rejected;
+                    return false;
+                }
+
+                messages.emplace_back(payload, length);
+                return true;
+            };
+        }
+    };
+
+    // 2026-10-19 00:00:00 UTC
+    constexpr uint32_t StartTime = 1792368000;
+
+    TelemetryOutbox* outbox = nullptr;
+    MockBroker* broker = nullptr;
+
+    // The index-th sample since StartTime
+    TelemetryOutbox::Entry entry(const uint32_t index)
+    {
+        TelemetryOutbox::Entry e;
+        e.timestamp = StartTime + index * TelemetryOutbox::SampleIntervalSecs;
+        e.currentTemp = 200;
+        e.targetTemp = 215;
+        return e;
+    }
+
+    std::string entryJson(const uint32_t index)
+    {
+        return R"({"ts":)" + std::to_string(StartTime + index * TelemetryOutbox::SampleIntervalSecs) + R"(,"current":20.0,"target":21.5,"heating":false,"boost":false})";
+    }
+
+    std::string batchJson(const uint32_t first, const uint32_t count)
+    {
+        std::string json = "[";
+
+        for (auto i = 0u; i < count; ++i) {
+            if (i > 0) {
+                json += ",";
+            }
+            json += entryJson(first + i);
+        }
+
+        return json + "]";
+    }
+}
+
+void setUp()
+{
+    outbox = new TelemetryOutbox;
+    broker = new MockBroker;
+}
+
+void tearDown()
+{
+    delete broker;
+    delete outbox;
+}
+
+void test_empty_outbox_publishes_nothing()
+{
+    TEST_ASSERT_EQUAL_size_t(0, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(0, broker->messages.size());
+}
+
+void test_overflow_drops_oldest()
+{
+    constexpr auto Extra = 5u;
+
+    for (auto i = 0u; i < TelemetryOutbox::Capacity + Extra; ++i) {
+        outbox->push(entry(i));
+    }
+
+    TEST_ASSERT_EQUAL_size_t(TelemetryOutbox::Capacity, outbox->size());
+    TEST_ASSERT_EQUAL_UINT32(Extra, outbox->overflowCount());
+
+    outbox->drain(broker->publisher());
+
+    TEST_ASSERT_EQUAL_size_t(1, broker->messages.size());
+    TEST_ASSERT_EQUAL_STRING(batchJson(Extra, TelemetryOutbox::BatchSize).c_str(), broker->messages[0].c_str());
+}
+
+void test_drain_is_paced_in_batches()
+{
+    constexpr auto Count = 2 * TelemetryOutbox::BatchSize + 2;
+
+    for (auto i = 0u; i < Count; ++i) {
+        outbox->push(entry(i));
+    }
+
+    // One batch per call, the caller paces the calls
+    TEST_ASSERT_EQUAL_size_t(TelemetryOutbox::BatchSize, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(1, broker->messages.size());
+    TEST_ASSERT_EQUAL_size_t(Count - TelemetryOutbox::BatchSize, outbox->size());
+
+    TEST_ASSERT_EQUAL_size_t(TelemetryOutbox::BatchSize, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(2, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(0, outbox->drain(broker->publisher()));
+
+    TEST_ASSERT_TRUE(outbox->isEmpty());
+    TEST_ASSERT_EQUAL_size_t(3, broker->messages.size());
+
+    TEST_ASSERT_EQUAL_STRING(batchJson(0, TelemetryOutbox::BatchSize).c_str(), broker->messages[0].c_str());
+    TEST_ASSERT_EQUAL_STRING(batchJson(TelemetryOutbox::BatchSize, TelemetryOutbox::BatchSize).c_str(), broker->messages[1].c_str());
+    TEST_ASSERT_EQUAL_STRING(batchJson(2 * TelemetryOutbox::BatchSize, 2).c_str(), broker->messages[2].c_str());
+}
+
+void test_failed_publish_is_retried()
+{
+    for (auto i = 0u; i < TelemetryOutbox::BatchSize + 1; ++i) {
+        outbox->push(entry(i));
+    }
+
+    broker->accept = false;
+
+    TEST_ASSERT_EQUAL_size_t(0, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(0, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(2, broker->rejected);
+    TEST_ASSERT_EQUAL_size_t(TelemetryOutbox::BatchSize + 1, outbox->size());
+
+    // Samples taken meanwhile are queued behind the unsent ones
+    outbox->push(entry(100));
+
+    broker->accept = true;
+
+    TEST_ASSERT_EQUAL_size_t(TelemetryOutbox::BatchSize, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(2, outbox->drain(broker->publisher()));
+
+    TEST_ASSERT_EQUAL_size_t(2, broker->messages.size());
+    TEST_ASSERT_EQUAL_STRING(batchJson(0, TelemetryOutbox::BatchSize).c_str(), broker->messages[0].c_str());
+    TEST_ASSERT_EQUAL_STRING(("[" + entryJson(TelemetryOutbox::BatchSize) + "," + entryJson(100) + "]").c_str(), broker->messages[1].c_str());
+}
+
+void test_batch_json()
+{
+    TelemetryOutbox::Entry first;
+    first.timestamp = 1792368000;
+    first.currentTemp = -5;
+    first.targetTemp = 215;
+    first.heatingActive = true;
+    first.boostActive = false;
+
+    TelemetryOutbox::Entry second;
+    second.timestamp = 1792368060;
+    second.currentTemp = 0;
+    second.targetTemp = -123;
+    second.heatingActive = false;
+    second.boostActive = true;
+
+    outbox->push(first);
+    outbox->push(second);
+    outbox->drain(broker->publisher());
+
+    TEST_ASSERT_EQUAL_size_t(1, broker->messages.size());
+    TEST_ASSERT_EQUAL_STRING(
+        R"([{"ts":1792368000,"current":-0.5,"target":21.5,"heating":true,"boost":false},)"
+        R"({"ts":1792368060,"current":0.0,"target":-12.3,"heating":false,"boost":true}])",
+        broker->messages[0].c_str()
+    );
+}
+
+void test_longest_batch_fits()
+{
+    TelemetryOutbox::Entry longest;
+    longest.timestamp = UINT32_MAX;
+    longest.currentTemp = INT16_MIN;
+    longest.targetTemp = INT16_MIN;
+    longest.heatingActive = false;
+    longest.boostActive = false;
+
+    for (auto i = 0u; i < TelemetryOutbox::BatchSize; ++i) {
+        outbox->push(longest);
+    }
+
+    outbox->drain(broker->publisher());
+
+    const std::string entryText = R"({"ts":4294967295,"current":-3276.8,"target":-3276.8,"heating":false,"boost":false})";
+    std::string expected = "[";
+    for (auto i = 0u; i < TelemetryOutbox::BatchSize; ++i) {
+        expected += (i > 0 ? "," : "") + entryText;
+    }
+    expected += "]";
+
+    TEST_ASSERT_EQUAL_size_t(1, broker->messages.size());
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), broker->messages[0].c_str());
+}
+
+void test_unsynchronized_samples_are_ignored()
+{
+    // Boot-relative timestamps of a clock that hasn't been set yet
+    auto unsynchronized = entry(0);
+    unsynchronized.timestamp = 42;
+    outbox->push(unsynchronized);
+
+    unsynchronized.timestamp = Extras::SynchronizedTimeMin - 1;
+    outbox->push(unsynchronized);
+
+    TEST_ASSERT_TRUE(outbox->isEmpty());
+    TEST_ASSERT_EQUAL_size_t(0, outbox->drain(broker->publisher()));
+
+    outbox->push(entry(0));
+    outbox->push(unsynchronized);
+    outbox->push(entry(1));
+
+    TEST_ASSERT_EQUAL_size_t(2, outbox->drain(broker->publisher()));
+    TEST_ASSERT_EQUAL_size_t(1, broker->messages.size());
+    TEST_ASSERT_EQUAL_STRING(batchJson(0, 2).c_str(), broker->messages[0].c_str());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_outbox_publishes_nothing);
+    RUN_TEST(test_overflow_drops_oldest);
+    RUN_TEST(test_drain_is_paced_in_batches);
+    RUN_TEST(test_failed_publish_is_retried);
+    RUN_TEST(test_batch_json);
+    RUN_TEST(test_longest_batch_fits);
+    RUN_TEST(test_unsynchronized_samples_are_ignored);
+
+    return UNITY_END();
+}
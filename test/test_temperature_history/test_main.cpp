@@ -0,0 +1,193 @@
+/*
+    This file is part of esp-thermostat.
+
+    esp-thermostat is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    esp-thermostat is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with esp-thermostat.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-19
+*/
+
+
+// TemperatureHistory: delta encoding with saturation and sign extension,
+// starting new blocks on gaps, wrapping the block ring, and ignoring the
+// samples taken before the clock was synchronized.
+
+#include "Extras.h"
+#include "TemperatureHistory.h"
+
+#include <unity.h>
+
+namespace
+{
+    // 2026-10-19 00:00:00 UTC
+    constexpr std::time_t StartTime = 1792368000;
+    constexpr auto Interval = TemperatureHistory::SampleIntervalSecs;
+
+    TemperatureHistory* history = nullptr;
+
+    std::size_t queryAll(TemperatureHistory::Sample* samples, const std::size_t maxCount)
+    {
+        return history->query(0, StartTime * 2, samples, maxCount);
+    }
+
+    uint32_t chunkTimestamp(const std::size_t index)
+    {
+        TemperatureHistory::Block block;
+        TEST_ASSERT_EQUAL_size_t(TemperatureHistory::ChunkSize,
+            history->readChunk(index, reinterpret_cast<uint8_t*>(&block), sizeof(block)));
+        return block.timestamp;
+    }
+}
+
+void setUp()
+{
+    history = new TemperatureHistory;
+}
+
+void tearDown()
+{
+    delete history;
+}
+
+void test_samples_round_trip()
+{
+    // The largest deltas in both directions, the negative set point delta
+    // is sign-extended from 7 bits
+    const int16_t temperatures[] = { 215, 342, 214, 214 };
+    const int16_t setpoints[] = { 200, 263, 199, 199 };
+
+    for (auto i = 0u; i < 4; ++i) {
+        history->append(StartTime + i * Interval, temperatures[i], setpoints[i], i % 2 == 1);
+    }
+
+    TemperatureHistory::Sample samples[4];
+
+    TEST_ASSERT_EQUAL_size_t(4, queryAll(samples, 4));
+    TEST_ASSERT_EQUAL_size_t(1, history->chunkCount());
+
+    for (auto i = 0u; i < 4; ++i) {
+        TEST_ASSERT_EQUAL_INT(StartTime + i * Interval, samples[i].timestamp);
+        TEST_ASSERT_EQUAL_INT(temperatures[i], samples[i].temperature);
+        TEST_ASSERT_EQUAL_INT(setpoints[i], samples[i].setpoint);
+        TEST_ASSERT_EQUAL(i % 2 == 1, samples[i].relayActive);
+    }
+}
+
+void test_saturated_deltas_are_corrected()
+{
+    history->append(StartTime, 200, 200, false);
+    history->append(StartTime + Interval, 500, 50, false);
+    history->append(StartTime + 2 * Interval, 500, 50, false);
+    history->append(StartTime + 3 * Interval, 500, 50, false);
+
+    TemperatureHistory::Sample samples[4];
+
+    TEST_ASSERT_EQUAL_size_t(4, queryAll(samples, 4));
+
+    // +30.0 and -15.0 Celsius saturate at +12.7 and -6.4 per sample
+    TEST_ASSERT_EQUAL_INT(327, samples[1].temperature);
+    TEST_ASSERT_EQUAL_INT(136, samples[1].setpoint);
+    TEST_ASSERT_EQUAL_INT(454, samples[2].temperature);
+    TEST_ASSERT_EQUAL_INT(72, samples[2].setpoint);
+    TEST_ASSERT_EQUAL_INT(500, samples[3].temperature);
+    TEST_ASSERT_EQUAL_INT(50, samples[3].setpoint);
+}
+
+void test_gap_starts_new_block()
+{
+    history->append(StartTime, 200, 200, false);
+    history->append(StartTime + Interval, 201, 200, false);
+
+    // A missed sample, e.g. after a restart
+    history->append(StartTime + 5 * Interval, 190, 180, true);
+    history->append(StartTime + 6 * Interval, 191, 180, true);
+
+    TEST_ASSERT_EQUAL_size_t(2, history->chunkCount());
+    TEST_ASSERT_EQUAL_size_t(4, history->sampleCount());
+    TEST_ASSERT_EQUAL_UINT32(StartTime, chunkTimestamp(0));
+    TEST_ASSERT_EQUAL_UINT32(StartTime + 5 * Interval, chunkTimestamp(1));
+    TEST_ASSERT_EQUAL_INT(StartTime + 6 * Interval, history->newestTimestamp());
+
+    TemperatureHistory::Sample samples[4];
+
+    TEST_ASSERT_EQUAL_size_t(1, history->query(StartTime + 2 * Interval, StartTime + 5 * Interval, samples, 4));
+    TEST_ASSERT_EQUAL_INT(190, samples[0].temperature);
+    TEST_ASSERT_EQUAL_INT(180, samples[0].setpoint);
+    TEST_ASSERT_TRUE(samples[0].relayActive);
+}
+
+void test_full_block_starts_new_block()
+{
+    for (auto i = 0; i < TemperatureHistory::SamplesPerBlock + 1; ++i) {
+        history->append(StartTime + i * Interval, 200 + i, 200, false);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(2, history->chunkCount());
+    TEST_ASSERT_EQUAL_UINT32(StartTime + TemperatureHistory::SamplesPerBlock * Interval, chunkTimestamp(1));
+}
+
+void test_ring_wraps_to_oldest_block()
+{
+    constexpr auto Extra = 3;
+
+    // One single-sample block per hour
+    for (auto i = 0; i < TemperatureHistory::BlockCount + Extra; ++i) {
+        history->append(StartTime + i * 3600, static_cast<int16_t>(i), 200, false);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(TemperatureHistory::BlockCount, history->chunkCount());
+    TEST_ASSERT_EQUAL_size_t(TemperatureHistory::BlockCount, history->sampleCount());
+    TEST_ASSERT_EQUAL_INT(StartTime + Extra * 3600, history->oldestTimestamp());
+
+    for (auto i = 0; i < TemperatureHistory::BlockCount; ++i) {
+        TEST_ASSERT_EQUAL_UINT32(StartTime + (Extra + i) * 3600, chunkTimestamp(i));
+    }
+
+    TemperatureHistory::Sample samples[TemperatureHistory::BlockCount];
+
+    TEST_ASSERT_EQUAL_size_t(TemperatureHistory::BlockCount, queryAll(samples, TemperatureHistory::BlockCount));
+    TEST_ASSERT_EQUAL_INT(Extra, samples[0].temperature);
+    TEST_ASSERT_EQUAL_INT(Extra + TemperatureHistory::BlockCount - 1, samples[TemperatureHistory::BlockCount - 1].temperature);
+}
+
+void test_unsynchronized_samples_are_ignored()
+{
+    // Boot-relative timestamps of a clock that hasn't been set yet
+    history->append(60, 200, 200, false);
+    history->append(120, 200, 200, false);
+
+    TEST_ASSERT_EQUAL_size_t(0, history->chunkCount());
+
+    history->append(StartTime, 200, 200, false);
+    history->append(Extras::SynchronizedTimeMin - 1, 200, 200, false);
+    history->append(StartTime + Interval, 201, 200, false);
+
+    TEST_ASSERT_EQUAL_size_t(1, history->chunkCount());
+    TEST_ASSERT_EQUAL_size_t(2, history->sampleCount());
+    TEST_ASSERT_EQUAL_INT(StartTime, history->oldestTimestamp());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_samples_round_trip);
+    RUN_TEST(test_saturated_deltas_are_corrected);
+    RUN_TEST(test_gap_starts_new_block);
+    RUN_TEST(test_full_block_starts_new_block);
+    RUN_TEST(test_ring_wraps_to_oldest_block);
+    RUN_TEST(test_unsynchronized_samples_are_ignored);
+
+    return UNITY_END();
+}